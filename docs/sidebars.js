@@ -60,7 +60,7 @@ const sidebars = {
       collapsed: true,
       type: "category",
       label: "Images",
-      items: ["image", "image-svg", "snapshotviews"],
+      items: ["image", "image-svg", "atlas", "snapshotviews"],
     },
     {
       collapsed: true,
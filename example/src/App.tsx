@@ -22,6 +22,7 @@ import {
   Glassmorphism,
   Neumorphism,
   PerformanceDrawingTest,
+  PerformanceBatchingTest,
   Wallpaper,
   Vertices,
   Wallet,
@@ -55,6 +56,7 @@ const linking: LinkingOptions<StackParamList> = {
       Animation: "animation",
       Reanimated: "reanimated",
       Performance: "performance",
+      Batching: "batching",
       Tests: "test",
       Transitions: "transitions",
       Stickers: "stickers",
@@ -182,6 +184,7 @@ const App = () => {
               name="Performance"
               component={PerformanceDrawingTest}
             />
+            <Stack.Screen name="Batching" component={PerformanceBatchingTest} />
           </Stack.Navigator>
         </NavigationContainer>
       </GestureHandlerRootView>
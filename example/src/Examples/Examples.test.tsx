@@ -9,7 +9,7 @@ import { Aurora } from "./Aurora";
 import { Wallet } from "./Wallet";
 import { Vertices } from "./Vertices";
 import { Severance } from "./Severance";
-import { PerformanceDrawingTest } from "./Performance";
+import { PerformanceBatchingTest, PerformanceDrawingTest } from "./Performance";
 import { GraphsScreen } from "./Graphs";
 import { SimpleAnimation } from "./Animation/SimpleAnimation";
 import { InterpolationWithEasing } from "./Animation/InterpolationWithEasing";
@@ -58,6 +58,10 @@ it("should render the Performance example correctly", () => {
   render(<PerformanceDrawingTest />);
 });
 
+it("should render the Batching example correctly", () => {
+  render(<PerformanceBatchingTest />);
+});
+
 it("should render the Neumorphism example correctly", () => {
   render(<Neumorphism />);
 });
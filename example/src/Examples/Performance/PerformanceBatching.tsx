@@ -0,0 +1,176 @@
+import {
+  Canvas,
+  Group,
+  Rect,
+  Skia,
+  SkiaView,
+  useValue,
+  useComputedValue,
+  useTouchHandler,
+} from "@shopify/react-native-skia";
+import type { DrawingInfo, SkCanvas } from "@shopify/react-native-skia";
+import React, { useCallback, useMemo, useState } from "react";
+import {
+  Button,
+  StyleSheet,
+  Switch,
+  Text,
+  useWindowDimensions,
+  View,
+} from "react-native";
+
+const Colors = ["#61DAFB", "#fb61da", "#dafb61"];
+const Size = 8;
+const Gap = 2;
+const Increaser = 500;
+
+// Many small cells with identical paints, like the cells of a heatmap. The
+// cells are a few pixels apart so that the antialiased ones can be merged.
+export const PerformanceBatchingTest: React.FC = () => {
+  const [isDeclarative, setIsDeclarative] = useState(false);
+  const [optimize, setOptimize] = useState(true);
+  const [numberOfCells, setNumberOfCells] = useState(2000);
+
+  const { width } = useWindowDimensions();
+  const columns = Math.floor(width / (Size + Gap));
+
+  const cells = useMemo(
+    () =>
+      new Array(numberOfCells)
+        .fill(0)
+        .map((_, i) =>
+          Skia.XYWHRect(
+            (i % columns) * (Size + Gap),
+            Math.floor(i / columns) * (Size + Gap),
+            Size,
+            Size
+          )
+        ),
+    [numberOfCells, columns]
+  );
+
+  const paints = useMemo(
+    () =>
+      Colors.map((color) => {
+        const p = Skia.Paint();
+        p.setAntiAlias(true);
+        p.setColor(Skia.Color(color));
+        return p;
+      }),
+    []
+  );
+
+  // Moving the grid changes the translation only, which doesn't prevent
+  // the cells from being merged
+  const offset = useValue({ x: 0, y: 0 });
+  const onTouch = useTouchHandler({
+    onActive: ({ x, y }) => {
+      offset.current = { x: x - width / 2, y: y - width / 2 };
+    },
+  });
+  const transform = useComputedValue(
+    () => [{ translateX: offset.current.x }, { translateY: offset.current.y }],
+    [offset]
+  );
+
+  const draw = useCallback(
+    (canvas: SkCanvas, info: DrawingInfo) => {
+      const touch = info.touches.length > 0 ? info.touches[0][0] : undefined;
+      if (touch) {
+        offset.current = { x: touch.x - width / 2, y: touch.y - width / 2 };
+      }
+      canvas.translate(offset.current.x, offset.current.y);
+      // Each cell is drawn in its own translated save / restore, like the
+      // nodes of the declarative tree
+      for (let i = 0; i < cells.length; i++) {
+        canvas.save();
+        canvas.translate(cells[i].x, cells[i].y);
+        canvas.drawRect(
+          Skia.XYWHRect(0, 0, Size, Size),
+          paints[Math.floor(i / columns) % paints.length]
+        );
+        canvas.restore();
+      }
+    },
+    [cells, columns, offset, paints, width]
+  );
+
+  return (
+    <View style={styles.container}>
+      <View style={styles.mode}>
+        <View style={styles.panel}>
+          <Button
+            title="⬇️"
+            onPress={() => setNumberOfCells((n) => Math.max(0, n - Increaser))}
+          />
+          <Text>&nbsp;Cells&nbsp;</Text>
+          <Text>{numberOfCells}</Text>
+          <Text>&nbsp;</Text>
+          <Button
+            title="⬆️"
+            onPress={() => setNumberOfCells((n) => n + Increaser)}
+          />
+        </View>
+        <View style={styles.panel}>
+          <Text>Declarative&nbsp;</Text>
+          <Switch
+            value={isDeclarative}
+            onValueChange={() => setIsDeclarative((p) => !p)}
+          />
+        </View>
+        {!isDeclarative && (
+          <View style={styles.panel}>
+            <Text>Optimize&nbsp;</Text>
+            <Switch
+              value={optimize}
+              onValueChange={() => setOptimize((p) => !p)}
+            />
+          </View>
+        )}
+      </View>
+      {isDeclarative ? (
+        <Canvas
+          style={styles.container}
+          debug
+          mode="continuous"
+          onTouch={onTouch}
+        >
+          <Group transform={transform}>
+            {cells.map((cell, i) => (
+              <Rect
+                key={i}
+                rect={cell}
+                color={Colors[Math.floor(i / columns) % Colors.length]}
+              />
+            ))}
+          </Group>
+        </Canvas>
+      ) : (
+        <SkiaView
+          style={styles.container}
+          onDraw={draw}
+          optimize={optimize}
+          mode="continuous"
+          debug
+        />
+      )}
+    </View>
+  );
+};
+
+const styles = StyleSheet.create({
+  container: {
+    flex: 1,
+  },
+  mode: {
+    paddingHorizontal: 10,
+    paddingVertical: 4,
+    flexDirection: "row",
+    alignItems: "center",
+    justifyContent: "space-between",
+  },
+  panel: {
+    flexDirection: "row",
+    alignItems: "center",
+  },
+});
@@ -1,2 +1,3 @@
 export { PerformanceDrawingTest } from "./PerformanceRects";
+export { PerformanceBatchingTest } from "./PerformanceBatching";
 //export { PerformanceDrawingTest } from "./PerformanceCanvases";
@@ -98,6 +98,11 @@ export const HomeScreen = () => {
         description="Drawing Performance Test"
         route="Performance"
       />
+      <HomeScreenButton
+        title="🧱 Batching"
+        description="Many small shapes with identical paints"
+        route="Batching"
+      />
       <HomeScreenButton
         title="🔧 E2E Tests"
         description="Run integration tests"
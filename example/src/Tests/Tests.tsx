@@ -27,18 +27,30 @@ export const Tests = ({ assets }: TestsProps) => {
     if (client !== null) {
       client.onmessage = (e) => {
         const tree: any = JSON.parse(e.data);
-        if (tree.code) {
-          client.send(
-            JSON.stringify(
-              // eslint-disable-next-line no-eval
-              eval(
-                `(function Main(){return (${tree.code})(this.Skia, this.ctx); })`
-              ).call({
-                Skia,
-                ctx: parseProps(tree.ctx, assets),
-              })
-            )
-          );
+        if (tree.hitTest) {
+          // Queries are in the coordinates of the drawing
+          const { x, y, width, height } = tree.hitTest;
+          const query =
+            width === undefined
+              ? { x: x * scale, y: y * scale }
+              : Skia.XYWHRect(
+                  x * scale,
+                  y * scale,
+                  width * scale,
+                  height * scale
+                );
+          client.send(JSON.stringify(ref.current?.hitTest(query) ?? []));
+        } else if (tree.code) {
+          // The code can return a promise, for instance to test async APIs
+          Promise.resolve(
+            // eslint-disable-next-line no-eval
+            eval(
+              `(function Main(){return (${tree.code})(this.Skia, this.ctx); })`
+            ).call({
+              Skia,
+              ctx: parseProps(tree.ctx, assets),
+            })
+          ).then((result) => client.send(JSON.stringify(result)));
         } else {
           const node = parseNode(tree, assets);
           setDrawing(node as SerializedNode);
@@ -21,6 +21,7 @@ export type StackParamList = {
   Animation: undefined;
   Reanimated: undefined;
   Performance: undefined;
+  Batching: undefined;
   Transitions: undefined;
   Stickers: undefined;
 };
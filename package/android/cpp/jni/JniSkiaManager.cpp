@@ -18,6 +18,8 @@ void JniSkiaManager::registerNatives() {
       makeNativeMethod("initHybrid", JniSkiaManager::initHybrid),
       makeNativeMethod("initializeRuntime", JniSkiaManager::initializeRuntime),
       makeNativeMethod("invalidate", JniSkiaManager::invalidate),
+      makeNativeMethod("didReceiveMemoryWarning",
+                       JniSkiaManager::didReceiveMemoryWarning),
   });
 }
 
@@ -60,6 +60,12 @@ public:
     _context = nullptr;
   }
 
+  void didReceiveMemoryWarning() {
+    if (_skManager != nullptr) {
+      _skManager->didReceiveMemoryWarning();
+    }
+  }
+
 private:
   friend HybridBase;
 
@@ -4,11 +4,46 @@
 #include <android/native_window.h>
 #include <android/native_window_jni.h>
 
+#include <chrono>
+#include <memory>
+#include <utility>
+
 #define STENCIL_BUFFER_SIZE 8
 
 namespace RNSkia {
-/** Static members */
-sk_sp<SkSurface> MakeOffscreenGLSurface(int width, int height) {
+/**
+ OpenGL and Skia context for offscreen surfaces, created once per thread and
+ shared by all offscreen surfaces made on that thread. Destroyed when the
+ thread exits, the Javascript thread for instance exits when the app is
+ reloaded.
+ */
+struct OffscreenGLContext {
+  EGLDisplay display;
+  EGLSurface surface;
+  EGLContext context;
+  sk_sp<GrDirectContext> skContext;
+
+  ~OffscreenGLContext() {
+    if (eglMakeCurrent(display, surface, surface, context)) {
+      // Surfaces still alive keep the Skia context, which must not use the
+      // OpenGL context once it is destroyed
+      skContext->releaseResourcesAndAbandonContext();
+    } else {
+      skContext->abandonContext();
+    }
+    skContext = nullptr;
+    eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    eglDestroySurface(display, surface);
+    eglDestroyContext(display, context);
+  }
+};
+
+// Textures of deleted surfaces are kept for new surfaces of the same size,
+// up to this budget and as long as they were used recently
+static constexpr size_t OffscreenResourceCacheBytes = 32 * 1024 * 1024;
+static constexpr std::chrono::seconds OffscreenResourceIdleTime{10};
+
+static std::unique_ptr<OffscreenGLContext> MakeOffscreenGLContext() {
   EGLDisplay eglDisplay = eglGetDisplay(EGL_DEFAULT_DISPLAY);
   if (eglDisplay == EGL_NO_DISPLAY) {
     RNSkLogger::logToConsole("eglGetdisplay failed : %i", glGetError());
@@ -59,59 +94,57 @@ sk_sp<SkSurface> MakeOffscreenGLSurface(int width, int height) {
     return nullptr;
   }
 
-  const EGLint offScreenSurfaceAttribs[] = {EGL_WIDTH, width, EGL_HEIGHT,
-                                            height, EGL_NONE};
+  // Surfaces render to textures, the pbuffer is only needed to make the
+  // context current
+  const EGLint offScreenSurfaceAttribs[] = {EGL_WIDTH, 1, EGL_HEIGHT, 1,
+                                            EGL_NONE};
   EGLSurface eglSurface =
       eglCreatePbufferSurface(eglDisplay, eglConfig, offScreenSurfaceAttribs);
   if (!eglMakeCurrent(eglDisplay, eglSurface, eglSurface, eglContext)) {
     RNSkLogger::logToConsole("eglMakeCurrent failed: %d\n", eglGetError());
+    eglDestroySurface(eglDisplay, eglSurface);
+    eglDestroyContext(eglDisplay, eglContext);
     return nullptr;
   }
-  GLint buffer;
-  glGetIntegerv(GL_FRAMEBUFFER_BINDING, &buffer);
-
-  GLint stencil;
-  glGetIntegerv(GL_STENCIL_BITS, &stencil);
-
-  GLint samples;
-  glGetIntegerv(GL_SAMPLES, &samples);
 
   // Create the Skia backend context
   auto backendInterface = GrGLMakeNativeInterface();
   auto grContext = GrDirectContext::MakeGL(backendInterface);
   if (grContext == nullptr) {
     RNSkLogger::logToConsole("GrDirectContext::MakeGL failed");
+    eglMakeCurrent(eglDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE,
+                   EGL_NO_CONTEXT);
+    eglDestroySurface(eglDisplay, eglSurface);
+    eglDestroyContext(eglDisplay, eglContext);
     return nullptr;
   }
-  auto maxSamples =
-      grContext->maxSurfaceSampleCountForColorType(kRGBA_8888_SkColorType);
-
-  if (samples > maxSamples)
-    samples = maxSamples;
-
-  GrGLFramebufferInfo fbInfo;
-  fbInfo.fFBOID = buffer;
-  fbInfo.fFormat = 0x8058;
-
-  auto renderTarget =
-      GrBackendRenderTarget(width, height, samples, stencil, fbInfo);
-
-  struct OffscreenRenderContext {
-    EGLDisplay display;
-    EGLSurface surface;
-  };
-  auto ctx = new OffscreenRenderContext({eglDisplay, eglSurface});
-
-  auto surface = SkSurface::MakeFromBackendRenderTarget(
-      grContext.get(), renderTarget, kBottomLeft_GrSurfaceOrigin,
-      kRGBA_8888_SkColorType, nullptr, nullptr,
-      [](void *addr) {
-        auto ctx = reinterpret_cast<OffscreenRenderContext *>(addr);
-        eglDestroySurface(ctx->display, ctx->surface);
-        delete ctx;
-      },
-      reinterpret_cast<void *>(ctx));
-  return surface;
+
+  grContext->setResourceCacheLimit(OffscreenResourceCacheBytes);
+  // Initialized in place, a temporary would destroy the contexts
+  return std::unique_ptr<OffscreenGLContext>(new OffscreenGLContext{
+      eglDisplay, eglSurface, eglContext, std::move(grContext)});
+}
+
+/** Static members */
+sk_sp<SkSurface> MakeOffscreenGLSurface(int width, int height) {
+  thread_local std::unique_ptr<OffscreenGLContext> ctx;
+  if (ctx == nullptr) {
+    ctx = MakeOffscreenGLContext();
+    if (ctx == nullptr) {
+      return nullptr;
+    }
+  } else if (!eglMakeCurrent(ctx->display, ctx->surface, ctx->surface,
+                             ctx->context)) {
+    // Another context might have been made current on this thread
+    RNSkLogger::logToConsole("eglMakeCurrent failed: %d\n", eglGetError());
+    return nullptr;
+  }
+  ctx->skContext->performDeferredCleanup(OffscreenResourceIdleTime);
+
+  return SkSurface::MakeRenderTarget(
+      ctx->skContext.get(), SkBudgeted::kYes,
+      SkImageInfo::Make(width, height, kRGBA_8888_SkColorType,
+                        kPremul_SkAlphaType));
 }
 
 std::shared_ptr<OpenGLDrawingContext>
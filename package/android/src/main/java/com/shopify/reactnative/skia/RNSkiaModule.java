@@ -2,6 +2,8 @@
 
 package com.shopify.reactnative.skia;
 
+import android.content.ComponentCallbacks2;
+import android.content.res.Configuration;
 import android.util.Log;
 
 import com.facebook.react.bridge.LifecycleEventListener;
@@ -13,7 +15,7 @@ import com.facebook.react.module.annotations.ReactModule;
 import java.lang.ref.WeakReference;
 
 @ReactModule(name="RNSkia")
-public class RNSkiaModule extends ReactContextBaseJavaModule implements LifecycleEventListener {
+public class RNSkiaModule extends ReactContextBaseJavaModule implements LifecycleEventListener, ComponentCallbacks2 {
     public static final String NAME = "RNSkia";
 
     private final WeakReference<ReactApplicationContext> weakReactContext;
@@ -23,6 +25,7 @@ public class RNSkiaModule extends ReactContextBaseJavaModule implements Lifecycl
         super(reactContext);
         this.weakReactContext = new WeakReference<>(reactContext);
         reactContext.addLifecycleEventListener(this);
+        reactContext.registerComponentCallbacks(this);
     }
 
     @Override
@@ -31,6 +34,7 @@ public class RNSkiaModule extends ReactContextBaseJavaModule implements Lifecycl
 
         if (getReactApplicationContext() != null) {
             getReactApplicationContext().removeLifecycleEventListener(this);
+            getReactApplicationContext().unregisterComponentCallbacks(this);
         }
 
         if (this.skiaManager != null) {
@@ -85,4 +89,23 @@ public class RNSkiaModule extends ReactContextBaseJavaModule implements Lifecycl
     public void onHostDestroy() {
 
     }
+
+    @Override
+    public void onTrimMemory(int level) {
+        // Release the pooled surfaces when the system is running low on memory
+        // or the app went to the background
+        if (level >= ComponentCallbacks2.TRIM_MEMORY_RUNNING_LOW && skiaManager != null) {
+            skiaManager.didReceiveMemoryWarning();
+        }
+    }
+
+    @Override
+    public void onLowMemory() {
+        if (skiaManager != null) skiaManager.didReceiveMemoryWarning();
+    }
+
+    @Override
+    public void onConfigurationChanged(Configuration newConfig) {
+
+    }
 }
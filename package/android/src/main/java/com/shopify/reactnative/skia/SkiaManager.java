@@ -53,5 +53,6 @@ public class SkiaManager {
 
     private native void initializeRuntime();
     public native void invalidate();
+    public native void didReceiveMemoryWarning();
 
 }
\ No newline at end of file
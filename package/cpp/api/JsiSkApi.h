@@ -41,6 +41,7 @@
 #include "JsiSkTextBlobFactory.h"
 #include "JsiSkTypeface.h"
 #include "JsiSkTypefaceFactory.h"
+#include "JsiSkVertexBuffer.h"
 #include "JsiSkVertices.h"
 
 namespace RNSkia {
@@ -69,6 +70,8 @@ public:
     installFunction("ContourMeasureIter",
                     JsiSkContourMeasureIter::createCtor(context));
     installFunction("MakeVertices", JsiSkVertices::createCtor(context));
+    installFunction("MakeVertexBuffer",
+                    JsiSkVertexBuffer::createCtor(context));
     installFunction("PictureRecorder",
                     JsiSkPictureRecorder::createCtor(context));
     installFunction("Color", JsiSkColor::createCtor());
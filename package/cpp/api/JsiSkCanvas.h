@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -15,7 +17,9 @@
 #include "JsiSkRRect.h"
 #include "JsiSkSVG.h"
 #include "JsiSkTextBlob.h"
+#include "JsiSkVertexBuffer.h"
 #include "JsiSkVertices.h"
+#include "JsiTypedArray.h"
 
 #include <jsi/jsi.h>
 
@@ -55,9 +59,9 @@ public:
   }
 
   JSI_HOST_FUNCTION(drawRect) {
-    auto rect = JsiSkRect::fromValue(runtime, arguments[0]);
+    auto rect = JsiSkRect::getRect(runtime, arguments[0]);
     auto paint = JsiSkPaint::fromValue(runtime, arguments[1]);
-    _canvas->drawRect(*rect, *paint);
+    _canvas->drawRect(rect, *paint);
     return jsi::Value::undefined();
   }
 
@@ -75,11 +79,11 @@ public:
 
   JSI_HOST_FUNCTION(drawImageRect) {
     auto image = JsiSkImage::fromValue(runtime, arguments[0]);
-    auto src = JsiSkRect::fromValue(runtime, arguments[1]);
-    auto dest = JsiSkRect::fromValue(runtime, arguments[2]);
+    auto src = JsiSkRect::getRect(runtime, arguments[1]);
+    auto dest = JsiSkRect::getRect(runtime, arguments[2]);
     auto paint = JsiSkPaint::fromValue(runtime, arguments[3]);
     auto fastSample = count < 5 ? false : arguments[4].getBool();
-    _canvas->drawImageRect(image, *src, *dest, SkSamplingOptions(), paint.get(),
+    _canvas->drawImageRect(image, src, dest, SkSamplingOptions(), paint.get(),
                            fastSample ? SkCanvas::kFast_SrcRectConstraint
                                       : SkCanvas::kStrict_SrcRectConstraint);
     return jsi::Value::undefined();
@@ -119,8 +123,8 @@ public:
 
   JSI_HOST_FUNCTION(drawImageNine) {
     auto image = JsiSkImage::fromValue(runtime, arguments[0]);
-    auto center = JsiSkRect::fromValue(runtime, arguments[1]);
-    auto dest = JsiSkRect::fromValue(runtime, arguments[2]);
+    auto center = JsiSkRect::getRect(runtime, arguments[1]);
+    auto dest = JsiSkRect::getRect(runtime, arguments[2]);
     auto fm = (SkFilterMode)arguments[3].asNumber();
     std::shared_ptr<SkPaint> paint;
     if (count == 5) {
@@ -128,15 +132,14 @@ public:
         paint = JsiSkPaint::fromValue(runtime, arguments[4]);
       }
     }
-    _canvas->drawImageNine(image.get(), center->round(), *dest, fm,
-                           paint.get());
+    _canvas->drawImageNine(image.get(), center.round(), dest, fm, paint.get());
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(drawImageRectCubic) {
     auto image = JsiSkImage::fromValue(runtime, arguments[0]);
-    auto src = JsiSkRect::fromValue(runtime, arguments[1]);
-    auto dest = JsiSkRect::fromValue(runtime, arguments[2]);
+    auto src = JsiSkRect::getRect(runtime, arguments[1]);
+    auto dest = JsiSkRect::getRect(runtime, arguments[2]);
     float B = arguments[3].asNumber();
     float C = arguments[4].asNumber();
     std::shared_ptr<SkPaint> paint;
@@ -147,15 +150,15 @@ public:
     }
     auto constraint =
         SkCanvas::kStrict_SrcRectConstraint; // TODO: get from caller
-    _canvas->drawImageRect(image.get(), *src, *dest, SkSamplingOptions({B, C}),
+    _canvas->drawImageRect(image.get(), src, dest, SkSamplingOptions({B, C}),
                            paint.get(), constraint);
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(drawImageRectOptions) {
     auto image = JsiSkImage::fromValue(runtime, arguments[0]);
-    auto src = JsiSkRect::fromValue(runtime, arguments[1]);
-    auto dest = JsiSkRect::fromValue(runtime, arguments[2]);
+    auto src = JsiSkRect::getRect(runtime, arguments[1]);
+    auto dest = JsiSkRect::getRect(runtime, arguments[2]);
     auto filter = (SkFilterMode)arguments[3].asNumber();
     auto mipmap = (SkMipmapMode)arguments[4].asNumber();
     std::shared_ptr<SkPaint> paint;
@@ -165,7 +168,7 @@ public:
       }
     }
     auto constraint = SkCanvas::kStrict_SrcRectConstraint;
-    _canvas->drawImageRect(image.get(), *src, *dest, {filter, mipmap},
+    _canvas->drawImageRect(image.get(), src, dest, {filter, mipmap},
                            paint.get(), constraint);
     return jsi::Value::undefined();
   }
@@ -182,42 +185,42 @@ public:
   }
 
   JSI_HOST_FUNCTION(drawArc) {
-    auto oval = JsiSkRect::fromValue(runtime, arguments[0]);
+    auto oval = JsiSkRect::getRect(runtime, arguments[0]);
 
     SkScalar startAngle = arguments[1].asNumber();
     SkScalar sweepAngle = arguments[2].asNumber();
     bool useCenter = arguments[3].getBool();
 
     auto paint = JsiSkPaint::fromValue(runtime, arguments[4]);
-    _canvas->drawArc(*oval, startAngle, sweepAngle, useCenter, *paint);
+    _canvas->drawArc(oval, startAngle, sweepAngle, useCenter, *paint);
 
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(drawRRect) {
-    auto rect = JsiSkRRect::fromValue(runtime, arguments[0]);
+    auto rect = JsiSkRRect::getRRect(runtime, arguments[0]);
     auto paint = JsiSkPaint::fromValue(runtime, arguments[1]);
 
-    _canvas->drawRRect(*rect, *paint);
+    _canvas->drawRRect(rect, *paint);
 
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(drawDRRect) {
-    auto outer = JsiSkRRect::fromValue(runtime, arguments[0]);
-    auto inner = JsiSkRRect::fromValue(runtime, arguments[1]);
+    auto outer = JsiSkRRect::getRRect(runtime, arguments[0]);
+    auto inner = JsiSkRRect::getRRect(runtime, arguments[1]);
     auto paint = JsiSkPaint::fromValue(runtime, arguments[2]);
 
-    _canvas->drawDRRect(*outer, *inner, *paint);
+    _canvas->drawDRRect(outer, inner, *paint);
 
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(drawOval) {
-    auto rect = JsiSkRect::fromValue(runtime, arguments[0]);
+    auto rect = JsiSkRect::getRect(runtime, arguments[0]);
     auto paint = JsiSkPaint::fromValue(runtime, arguments[1]);
 
-    _canvas->drawOval(*rect, *paint);
+    _canvas->drawOval(rect, *paint);
 
     return jsi::Value::undefined();
   }
@@ -234,6 +237,16 @@ public:
 
   JSI_HOST_FUNCTION(drawPoints) {
     auto pointMode = arguments[0].asNumber();
+    if (FloatArray::isTypedArray(runtime, arguments[1])) {
+      // Flat [x0, y0, x1, y1, ...] buffer, read in place as SkPoints
+      FloatArray coords(runtime, arguments[1]);
+      auto paint = JsiSkPaint::fromValue(runtime, arguments[2]);
+      _canvas->drawPoints((SkCanvas::PointMode)pointMode, coords.size() / 2,
+                          reinterpret_cast<const SkPoint *>(coords.data()),
+                          *paint);
+      return jsi::Value::undefined();
+    }
+
     std::vector<SkPoint> points;
 
     auto jsiPoints = arguments[1].asObject(runtime).asArray(runtime);
@@ -241,9 +254,8 @@ public:
     points.reserve(pointsSize);
 
     for (int i = 0; i < pointsSize; i++) {
-      std::shared_ptr<SkPoint> point = JsiSkPoint::fromValue(
-          runtime, jsiPoints.getValueAtIndex(runtime, i).asObject(runtime));
-      points.push_back(*point.get());
+      points.push_back(
+          JsiSkPoint::getPoint(runtime, jsiPoints.getValueAtIndex(runtime, i)));
     }
 
     auto paint = JsiSkPaint::fromValue(runtime, arguments[2]);
@@ -254,8 +266,93 @@ public:
     return jsi::Value::undefined();
   }
 
+  JSI_HOST_FUNCTION(drawLines) {
+    FloatArray coords(runtime, arguments[0]);
+    auto paint = JsiSkPaint::fromValue(runtime, arguments[1]);
+    _canvas->drawPoints(SkCanvas::kLines_PointMode, coords.size() / 2,
+                        reinterpret_cast<const SkPoint *>(coords.data()),
+                        *paint);
+    return jsi::Value::undefined();
+  }
+
+  JSI_HOST_FUNCTION(drawRects) {
+    FloatArray rects(runtime, arguments[0]);
+    auto paint = JsiSkPaint::fromValue(runtime, arguments[1]);
+    for (size_t i = 0; i + 3 < rects.size(); i += 4) {
+      _canvas->drawRect(
+          SkRect::MakeXYWH(rects[i], rects[i + 1], rects[i + 2], rects[i + 3]),
+          *paint);
+    }
+    return jsi::Value::undefined();
+  }
+
+  JSI_HOST_FUNCTION(drawCircles) {
+    FloatArray circles(runtime, arguments[0]);
+    auto paint = JsiSkPaint::fromValue(runtime, arguments[1]);
+    for (size_t i = 0; i + 2 < circles.size(); i += 3) {
+      _canvas->drawCircle(circles[i], circles[i + 1], circles[i + 2], *paint);
+    }
+    return jsi::Value::undefined();
+  }
+
+  JSI_HOST_FUNCTION(drawAtlas) {
+    auto image = JsiSkImage::fromValue(runtime, arguments[0]);
+    FloatArray sprites(runtime, arguments[1]);
+    FloatArray transforms(runtime, arguments[2]);
+    auto paint = JsiSkPaint::fromValue(runtime, arguments[3]);
+    auto blendMode = SkBlendMode::kSrcOver;
+    if (count >= 5 && !arguments[4].isNull() && !arguments[4].isUndefined()) {
+      blendMode = static_cast<SkBlendMode>(arguments[4].asNumber());
+    }
+    auto spritesSize =
+        static_cast<int>(std::min(sprites.size(), transforms.size()) / 4);
+
+    std::vector<SkRect> rects;
+    rects.reserve(spritesSize);
+    for (int i = 0; i < spritesSize; i++) {
+      rects.push_back(SkRect::MakeXYWH(sprites[i * 4], sprites[i * 4 + 1],
+                                       sprites[i * 4 + 2], sprites[i * 4 + 3]));
+    }
+    std::vector<SkColor> colors;
+    if (count >= 6 && !arguments[5].isNull() && !arguments[5].isUndefined()) {
+      colors = getColors(runtime, arguments[5], spritesSize);
+    }
+
+    _canvas->drawAtlas(
+        image.get(), reinterpret_cast<const SkRSXform *>(transforms.data()),
+        rects.data(), colors.empty() ? nullptr : colors.data(), spritesSize,
+        blendMode, SkSamplingOptions(), nullptr, paint.get());
+    return jsi::Value::undefined();
+  }
+
+  JSI_HOST_FUNCTION(drawVertexBuffers) {
+    auto mode = static_cast<SkVertices::VertexMode>(arguments[0].asNumber());
+    auto optional = [&](size_t index) {
+      return count > index ? jsi::Value(runtime, arguments[index])
+                           : jsi::Value::undefined();
+    };
+    auto colors = optional(3);
+    auto vertices = JsiSkVertexBuffer::MakeVertices(
+        runtime, mode, arguments[1], optional(2), colors, optional(4));
+
+    // Same defaults as the Vertices component
+    auto hasColors = !colors.isNull() && !colors.isUndefined();
+    auto blendMode =
+        count >= 6 && !arguments[5].isUndefined()
+            ? static_cast<SkBlendMode>(arguments[5].asNumber())
+            : (hasColors ? SkBlendMode::kDstOver : SkBlendMode::kSrcOver);
+    auto paint = count >= 7 && !arguments[6].isUndefined()
+                     ? JsiSkPaint::fromValue(runtime, arguments[6])
+                     : std::make_shared<SkPaint>();
+    _canvas->drawVertices(vertices, blendMode, *paint);
+    return jsi::Value::undefined();
+  }
+
   JSI_HOST_FUNCTION(drawVertices) {
-    auto vertices = JsiSkVertices::fromValue(runtime, arguments[0]);
+    auto buffer = JsiSkVertexBuffer::fromValue(runtime, arguments[0]);
+    auto vertices = buffer != nullptr
+                        ? buffer->makeVertices(runtime)
+                        : JsiSkVertices::fromValue(runtime, arguments[0]);
     auto blendMode = (SkBlendMode)arguments[1].getNumber();
     auto paint = JsiSkPaint::fromValue(runtime, arguments[2]);
     _canvas->drawVertices(vertices, blendMode, *paint);
@@ -271,9 +368,8 @@ public:
     auto cubicsSize = jsiCubics.size(runtime);
     cubics.reserve(cubicsSize);
     for (int i = 0; i < cubicsSize; i++) {
-      std::shared_ptr<SkPoint> point = JsiSkPoint::fromValue(
-          runtime, jsiCubics.getValueAtIndex(runtime, i).asObject(runtime));
-      cubics.push_back(*point.get());
+      cubics.push_back(
+          JsiSkPoint::getPoint(runtime, jsiCubics.getValueAtIndex(runtime, i)));
     }
 
     if (count >= 2 && !arguments[1].isNull() && !arguments[1].isUndefined()) {
@@ -292,9 +388,8 @@ public:
       auto texsSize = jsiTexs.size(runtime);
       texs.reserve(texsSize);
       for (int i = 0; i < texsSize; i++) {
-        auto point = JsiSkPoint::fromValue(
-            runtime, jsiTexs.getValueAtIndex(runtime, i).asObject(runtime));
-        texs.push_back(*point.get());
+        texs.push_back(
+            JsiSkPoint::getPoint(runtime, jsiTexs.getValueAtIndex(runtime, i)));
       }
     }
 
@@ -352,9 +447,8 @@ public:
     int pointsSize = static_cast<int>(jsiPositions.size(runtime));
     positions.reserve(pointsSize);
     for (int i = 0; i < pointsSize; i++) {
-      std::shared_ptr<SkPoint> point = JsiSkPoint::fromValue(
-          runtime, jsiPositions.getValueAtIndex(runtime, i).asObject(runtime));
-      positions.push_back(*point.get());
+      positions.push_back(JsiSkPoint::getPoint(
+          runtime, jsiPositions.getValueAtIndex(runtime, i)));
     }
 
     std::vector<SkGlyphID> glyphs;
@@ -394,18 +488,18 @@ public:
   }
 
   JSI_HOST_FUNCTION(clipRect) {
-    auto rect = JsiSkRect::fromValue(runtime, arguments[0]);
+    auto rect = JsiSkRect::getRect(runtime, arguments[0]);
     auto op = (SkClipOp)arguments[1].asNumber();
     auto doAntiAlias = arguments[2].getBool();
-    _canvas->clipRect(*rect, op, doAntiAlias);
+    _canvas->clipRect(rect, op, doAntiAlias);
     return jsi::Value::undefined();
   }
 
   JSI_HOST_FUNCTION(clipRRect) {
-    auto rrect = JsiSkRRect::fromValue(runtime, arguments[0]);
+    auto rrect = JsiSkRRect::getRRect(runtime, arguments[0]);
     auto op = (SkClipOp)arguments[1].asNumber();
     auto doAntiAlias = arguments[2].getBool();
-    _canvas->clipRRect(*rrect, op, doAntiAlias);
+    _canvas->clipRRect(rrect, op, doAntiAlias);
     return jsi::Value::undefined();
   }
 
@@ -415,17 +509,19 @@ public:
     SkPaint *paint = (count >= 1 && !arguments[0].isUndefined())
                          ? JsiSkPaint::fromValue(runtime, arguments[0]).get()
                          : nullptr;
-    SkRect *bounds =
-        count >= 2 && !arguments[1].isNull() && !arguments[1].isUndefined()
-            ? JsiSkRect::fromValue(runtime, arguments[1]).get()
-            : nullptr;
+    SkRect bounds;
+    bool hasBounds =
+        count >= 2 && !arguments[1].isNull() && !arguments[1].isUndefined();
+    if (hasBounds) {
+      bounds = JsiSkRect::getRect(runtime, arguments[1]);
+    }
     SkImageFilter *backdrop =
         count >= 3 && !arguments[2].isNull() && !arguments[2].isUndefined()
             ? JsiSkImageFilter::fromValue(runtime, arguments[2]).get()
             : nullptr;
     SkCanvas::SaveLayerFlags flags = count >= 4 ? arguments[3].asNumber() : 0;
-    return jsi::Value(_canvas->saveLayer(
-        SkCanvas::SaveLayerRec(bounds, paint, backdrop, flags)));
+    return jsi::Value(_canvas->saveLayer(SkCanvas::SaveLayerRec(
+        hasBounds ? &bounds : nullptr, paint, backdrop, flags)));
   }
 
   JSI_HOST_FUNCTION(restore) {
@@ -509,6 +605,11 @@ public:
                        JSI_EXPORT_FUNC(JsiSkCanvas, restoreToCount),
                        JSI_EXPORT_FUNC(JsiSkCanvas, getSaveCount),
                        JSI_EXPORT_FUNC(JsiSkCanvas, drawPoints),
+                       JSI_EXPORT_FUNC(JsiSkCanvas, drawLines),
+                       JSI_EXPORT_FUNC(JsiSkCanvas, drawRects),
+                       JSI_EXPORT_FUNC(JsiSkCanvas, drawCircles),
+                       JSI_EXPORT_FUNC(JsiSkCanvas, drawAtlas),
+                       JSI_EXPORT_FUNC(JsiSkCanvas, drawVertexBuffers),
                        JSI_EXPORT_FUNC(JsiSkCanvas, drawPatch),
                        JSI_EXPORT_FUNC(JsiSkCanvas, drawPath),
                        JSI_EXPORT_FUNC(JsiSkCanvas, drawVertices),
@@ -543,6 +644,27 @@ public:
   SkCanvas *getCanvas() { return _canvas; }
 
 private:
+  using FloatArray = RNJsi::JsiTypedArrayView<float>;
+
+  /**
+   Reads count colors from a flat Float32Array of [r, g, b, a] components
+   */
+  static std::vector<SkColor> getColors(jsi::Runtime &runtime,
+                                        const jsi::Value &value, int count) {
+    FloatArray components(runtime, value);
+    if (components.size() / 4 < static_cast<size_t>(count)) {
+      throw jsi::JSError(runtime, "Expected one color for each element.");
+    }
+    std::vector<SkColor> colors;
+    colors.reserve(count);
+    for (int i = 0; i < count; i++) {
+      colors.push_back(SkColor4f{components[i * 4], components[i * 4 + 1],
+                                 components[i * 4 + 2], components[i * 4 + 3]}
+                           .toSkColor());
+    }
+    return colors;
+  }
+
   SkCanvas *_canvas;
 };
 } // namespace RNSkia
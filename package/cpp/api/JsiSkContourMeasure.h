@@ -1,11 +1,14 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <utility>
 
 #include <jsi/jsi.h>
 
 #include "JsiSkHostObjects.h"
+#include "JsiTypedArray.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
@@ -50,6 +53,48 @@ public:
     return posTan;
   }
 
+  JSI_HOST_FUNCTION(getPosTans) {
+    auto output = count > 1 ? jsi::Value(runtime, arguments[1])
+                            : jsi::Value::undefined();
+    if (FloatArray::isTypedArray(runtime, arguments[0])) {
+      FloatArray distances(runtime, arguments[0]);
+      return writePosTans(runtime, std::move(output), distances.size(),
+                          [&](float *values) {
+                            std::copy(distances.data(),
+                                      distances.data() + distances.size(),
+                                      values);
+                          });
+    }
+    auto distances = arguments[0].asObject(runtime).asArray(runtime);
+    auto size = distances.size(runtime);
+    return writePosTans(runtime, std::move(output), size, [&](float *values) {
+      for (size_t i = 0; i < size; i++) {
+        values[i] = distances.getValueAtIndex(runtime, i).asNumber();
+      }
+    });
+  }
+
+  JSI_HOST_FUNCTION(samplePosTans) {
+    auto output = count > 1 ? jsi::Value(runtime, arguments[1])
+                            : jsi::Value::undefined();
+    auto samples = arguments[0].asNumber();
+    // Also keeps the result within the maximum length of a Float32Array
+    if (!std::isfinite(samples) || samples < 1 ||
+        samples != std::floor(samples) || samples > MaxSamples) {
+      throw jsi::JSError(runtime,
+                         "samplePosTans() expects a whole number of samples "
+                         "of at least 1");
+    }
+    auto size = static_cast<size_t>(samples);
+    auto length = getObject()->length();
+    return writePosTans(runtime, std::move(output), size, [&](float *values) {
+      auto step = size > 1 ? length / (size - 1) : 0;
+      for (size_t i = 0; i < size; i++) {
+        values[i] = step * i;
+      }
+    });
+  }
+
   JSI_HOST_FUNCTION(length) {
     return jsi::Value(SkScalarToDouble(getObject()->length()));
   }
@@ -71,9 +116,52 @@ public:
   EXPORT_JSI_API_TYPENAME(JsiSkContourMeasure, "ContourMeasure")
 
   JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(JsiSkContourMeasure, getPosTan),
+                       JSI_EXPORT_FUNC(JsiSkContourMeasure, getPosTans),
+                       JSI_EXPORT_FUNC(JsiSkContourMeasure, samplePosTans),
                        JSI_EXPORT_FUNC(JsiSkContourMeasure, length),
                        JSI_EXPORT_FUNC(JsiSkContourMeasure, isClosed),
                        JSI_EXPORT_FUNC(JsiSkContourMeasure, getSegment),
                        JSI_EXPORT_FUNC(JsiSkContourMeasure, dispose))
+
+private:
+  using FloatArray = RNJsi::JsiTypedArrayView<float>;
+
+  static constexpr double MaxSamples = (1u << 31) / 4;
+
+  /**
+   Writes [x, y, tx, ty] for size distances into the output Float32Array when
+   it is large enough, otherwise into a new one. The distances are first
+   written to the array by the given function, and are then replaced by the
+   positions and tangents in place.
+   */
+  template <typename ReadDistances>
+  jsi::Value writePosTans(jsi::Runtime &runtime, jsi::Value output,
+                          size_t size, const ReadDistances &readDistances) {
+    if (!output.isObject() || FloatArray(runtime, output).size() < size * 4) {
+      output = runtime.global()
+                   .getPropertyAsFunction(runtime, "Float32Array")
+                   .callAsConstructor(runtime, static_cast<double>(size * 4));
+    }
+    FloatArray values(runtime, output);
+    auto data = values.data();
+
+    // Distances go to the last quarter so that they are read before the
+    // slots they occupy are written
+    auto distances = data + size * 3;
+    readDistances(distances);
+    auto contour = getObject();
+    for (size_t i = 0; i < size; i++) {
+      SkPoint position;
+      SkVector tangent;
+      if (!contour->getPosTan(distances[i], &position, &tangent)) {
+        throw jsi::JSError(runtime, "getPosTans() failed");
+      }
+      data[i * 4] = position.x();
+      data[i * 4 + 1] = position.y();
+      data[i * 4 + 2] = tangent.x();
+      data[i * 4 + 3] = tangent.y();
+    }
+    return output;
+  }
 };
 } // namespace RNSkia
@@ -5,6 +5,7 @@
 
 #include "JsiSkContourMeasure.h"
 #include "JsiSkHostObjects.h"
+#include "RNSkContourMeasureCache.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
@@ -20,22 +21,23 @@ namespace RNSkia {
 namespace jsi = facebook::jsi;
 
 class JsiSkContourMeasureIter
-    : public JsiSkWrappingSharedPtrHostObject<SkContourMeasureIter> {
+    : public JsiSkWrappingSharedPtrHostObject<const RNSkContourMeasures> {
 public:
   JsiSkContourMeasureIter(std::shared_ptr<RNSkPlatformContext> context,
                           const SkPath &path, bool forceClosed,
                           SkScalar resScale = 1)
-      : JsiSkWrappingSharedPtrHostObject<SkContourMeasureIter>(
-            std::move(context), std::make_shared<SkContourMeasureIter>(
-                                    path, forceClosed, resScale)) {}
+      : JsiSkWrappingSharedPtrHostObject<const RNSkContourMeasures>(
+            std::move(context),
+            RNSkContourMeasureCache::getInstance().getContours(
+                path, forceClosed, resScale)) {}
 
   JSI_HOST_FUNCTION(next) {
-    auto next = getObject()->next();
-    if (next == nullptr) {
+    auto contours = getObject();
+    if (_next >= contours->size()) {
       return jsi::Value::undefined();
     }
-    auto nextObject =
-        std::make_shared<JsiSkContourMeasure>(getContext(), std::move(next));
+    auto nextObject = std::make_shared<JsiSkContourMeasure>(
+        getContext(), (*contours)[_next++]);
 
     return jsi::Object::createFromHostObject(runtime, std::move(nextObject));
   }
@@ -64,5 +66,8 @@ public:
                        std::move(context), *path, forceClosed, resScale));
     };
   }
+
+private:
+  size_t _next = 0;
 };
 } // namespace RNSkia
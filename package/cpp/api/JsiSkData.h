@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstring>
 #include <memory>
 #include <utility>
 
@@ -10,11 +11,18 @@
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
 
+#include "SkData.h"
 #include "SkFont.h"
 #include "SkStream.h"
 
 #pragma clang diagnostic pop
 
+// ArrayBuffers backed by native memory (jsi::MutableBuffer) are only available
+// in newer versions of JSI, older versions copy the bytes into a Uint8Array.
+#if defined(JSI_VERSION) && JSI_VERSION >= 9
+#define RNSKIA_JSI_MUTABLE_BUFFER 1
+#endif
+
 namespace RNSkia {
 
 namespace jsi = facebook::jsi;
@@ -26,5 +34,94 @@ public:
 
   EXPORT_JSI_API_TYPENAME(JsiSkData, "Data")
   JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(JsiSkData, dispose))
+
+  /**
+   Returns a copy of the bytes of a typed array or an ArrayBuffer. SkData is
+   immutable and read from other threads, for instance when images are
+   decoded lazily, while JS can change or free the array at any time.
+   */
+  static sk_sp<SkData> fromArrayBuffer(jsi::Runtime &runtime,
+                                       const jsi::Value &value) {
+    auto bytes = getBytes(runtime, value);
+    return SkData::MakeWithCopy(bytes.first, bytes.second);
+  }
+
+  /**
+   Returns data reading the bytes of a typed array or an ArrayBuffer in place.
+   JS can change or free the array once the host function returns, so the
+   data must only be read synchronously by the caller, and never kept.
+   */
+  static sk_sp<SkData> viewArrayBuffer(jsi::Runtime &runtime,
+                                       const jsi::Value &value) {
+    auto bytes = getBytes(runtime, value);
+    return SkData::MakeWithoutCopy(bytes.first, bytes.second);
+  }
+
+  /**
+   Returns a Uint8Array with the contents of the data. When supported by JSI
+   and the caller passes the only reference to the data, the array is backed
+   by the SkData memory itself. Otherwise the bytes are copied once into a new
+   array.
+   */
+  static jsi::Value toUint8Array(jsi::Runtime &runtime, sk_sp<SkData> data) {
+    auto arrayCtor =
+        runtime.global().getPropertyAsFunction(runtime, "Uint8Array");
+#ifdef RNSKIA_JSI_MUTABLE_BUFFER
+    if (!data->unique()) {
+      // JS can write to the array, which is only fine if nothing else reads
+      // the data
+      data = SkData::MakeWithCopy(data->data(), data->size());
+    }
+    auto buffer = jsi::ArrayBuffer(
+        runtime, std::make_shared<SkDataBuffer>(std::move(data)));
+    return arrayCtor.callAsConstructor(runtime, buffer);
+#else
+    size_t size = data->size();
+    jsi::Object array =
+        arrayCtor.callAsConstructor(runtime, static_cast<double>(size))
+            .getObject(runtime);
+    jsi::ArrayBuffer buffer =
+        array.getProperty(runtime, jsi::PropNameID::forAscii(runtime, "buffer"))
+            .asObject(runtime)
+            .getArrayBuffer(runtime);
+    memcpy(buffer.data(runtime), data->bytes(), size);
+    return array;
+#endif
+  }
+
+private:
+  static std::pair<const uint8_t *, size_t>
+  getBytes(jsi::Runtime &runtime, const jsi::Value &value) {
+    if (!value.isObject()) {
+      throw jsi::JSError(runtime, "Expected a typed array or an ArrayBuffer.");
+    }
+    auto object = value.asObject(runtime);
+    if (object.isArrayBuffer(runtime)) {
+      auto buffer = object.getArrayBuffer(runtime);
+      return {buffer.data(runtime), buffer.size(runtime)};
+    }
+    auto buffer = object.getProperty(runtime, "buffer")
+                      .asObject(runtime)
+                      .getArrayBuffer(runtime);
+    auto byteOffset = static_cast<size_t>(
+        object.getProperty(runtime, "byteOffset").asNumber());
+    auto byteLength = static_cast<size_t>(
+        object.getProperty(runtime, "byteLength").asNumber());
+    return {buffer.data(runtime) + byteOffset, byteLength};
+  }
+
+#ifdef RNSKIA_JSI_MUTABLE_BUFFER
+  class SkDataBuffer : public jsi::MutableBuffer {
+  public:
+    explicit SkDataBuffer(sk_sp<SkData> data) : _data(std::move(data)) {}
+    size_t size() const override { return _data->size(); }
+    uint8_t *data() override {
+      return static_cast<uint8_t *>(const_cast<void *>(_data->data()));
+    }
+
+  private:
+    sk_sp<SkData> _data;
+  };
+#endif
 };
 } // namespace RNSkia
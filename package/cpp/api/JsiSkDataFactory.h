@@ -47,27 +47,18 @@ public:
   };
 
   JSI_HOST_FUNCTION(fromBytes) {
-    auto array = arguments[0].asObject(runtime);
-    jsi::ArrayBuffer buffer =
-        array.getProperty(runtime, jsi::PropNameID::forAscii(runtime, "buffer"))
-            .asObject(runtime)
-            .getArrayBuffer(runtime);
-
-    auto data =
-        SkData::MakeWithCopy(buffer.data(runtime), buffer.size(runtime));
+    auto data = JsiSkData::fromArrayBuffer(runtime, arguments[0]);
     return jsi::Object::createFromHostObject(
         runtime, std::make_shared<JsiSkData>(getContext(), std::move(data)));
   }
 
   JSI_HOST_FUNCTION(fromBase64) {
-    auto base64 = arguments[0].asString(runtime);
-    auto base64Str = base64.utf8(runtime);
-    auto size = base64Str.size();
+    auto base64 = arguments[0].asString(runtime).utf8(runtime);
+    auto size = base64.size();
 
     // Calculate length
     size_t len;
-    auto err =
-        SkBase64::Decode(&base64.utf8(runtime).c_str()[0], size, nullptr, &len);
+    auto err = SkBase64::Decode(base64.c_str(), size, nullptr, &len);
     if (err != SkBase64::Error::kNoError) {
       throw jsi::JSError(runtime, "Error decoding base64 string");
       return jsi::Value::undefined();
@@ -75,8 +66,7 @@ public:
 
     // Create data object and decode
     auto data = SkData::MakeUninitialized(len);
-    err = SkBase64::Decode(&base64.utf8(runtime).c_str()[0], size,
-                           data->writable_data(), &len);
+    err = SkBase64::Decode(base64.c_str(), size, data->writable_data(), &len);
     if (err != SkBase64::Error::kNoError) {
       throw jsi::JSError(runtime, "Error decoding base64 string");
       return jsi::Value::undefined();
@@ -130,9 +130,8 @@ public:
     int pointsSize = static_cast<int>(jsiPositions.size(runtime));
     positions.reserve(pointsSize);
     for (int i = 0; i < pointsSize; i++) {
-      std::shared_ptr<SkPoint> point = JsiSkPoint::fromValue(
-          runtime, jsiPositions.getValueAtIndex(runtime, i).asObject(runtime));
-      positions.push_back(*point.get());
+      positions.push_back(JsiSkPoint::getPoint(
+          runtime, jsiPositions.getValueAtIndex(runtime, i)));
     }
 
     std::vector<SkGlyphID> glyphs;
@@ -1,9 +1,15 @@
 #pragma once
 
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdio>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "JsiPromises.h"
+#include "JsiSkData.h"
 #include "JsiSkHostObjects.h"
 #include "JsiSkMatrix.h"
 #include "JsiSkShader.h"
@@ -12,11 +18,14 @@
 #pragma clang diagnostic ignored "-Wdocumentation"
 
 #include "SkBase64.h"
+#include "SkBitmap.h"
 #include "SkImage.h"
+#include "SkPixmap.h"
 #include "SkStream.h"
 #include "include/codec/SkEncodedImageFormat.h"
 #include "include/encode/SkJpegEncoder.h"
 #include "include/encode/SkPngEncoder.h"
+#include "include/encode/SkWebpEncoder.h"
 
 #pragma clang diagnostic pop
 
@@ -26,6 +35,18 @@ namespace RNSkia {
 
 namespace jsi = facebook::jsi;
 
+struct ImageEncodeOptions {
+  SkEncodedImageFormat format = SkEncodedImageFormat::kPNG;
+  // JPEG and WebP quality, from 0 to 100
+  int quality = 100;
+  bool lossless = false;
+  int zlibLevel = 6;
+  int pngFilters = static_cast<int>(SkPngEncoder::FilterFlag::kAll);
+  // Size to scale the image to before encoding, 0 to keep the image size
+  int width = 0;
+  int height = 0;
+};
+
 class JsiSkImage : public JsiSkWrappingSkPtrHostObject<SkImage> {
 public:
   // TODO-API: Properties?
@@ -65,64 +86,96 @@ public:
   }
 
   JSI_HOST_FUNCTION(encodeToBytes) {
-    // Get optional parameters
-    auto format =
-        count >= 1 ? static_cast<SkEncodedImageFormat>(arguments[0].asNumber())
-                   : SkEncodedImageFormat::kPNG;
-    auto quality = count == 2 ? arguments[1].asNumber() : 100.0;
-
-    // Get data
-    sk_sp<SkData> data;
-    if (format == SkEncodedImageFormat::kJPEG) {
-      SkJpegEncoder::Options options;
-      options.fQuality = quality;
-      data = SkJpegEncoder::Encode(nullptr, getObject().get(), options);
-    } else {
-      SkPngEncoder::Options options;
-      data = SkPngEncoder::Encode(nullptr, getObject().get(), options);
+    auto options = getEncodeOptions(arguments, count);
+    SkDynamicMemoryWStream stream;
+    if (!encode(getRasterImage(), options, &stream)) {
+      return jsi::Value::null();
     }
-    auto arrayCtor =
-        runtime.global().getPropertyAsFunction(runtime, "Uint8Array");
-    size_t size = data->size();
-
-    jsi::Object array =
-        arrayCtor.callAsConstructor(runtime, static_cast<double>(size))
-            .getObject(runtime);
-    jsi::ArrayBuffer buffer =
-        array.getProperty(runtime, jsi::PropNameID::forAscii(runtime, "buffer"))
-            .asObject(runtime)
-            .getArrayBuffer(runtime);
-
-    auto bfrPtr = reinterpret_cast<uint8_t *>(buffer.data(runtime));
-    memcpy(bfrPtr, data->bytes(), size);
-    return array;
+    return JsiSkData::toUint8Array(runtime, stream.detachAsData());
   }
 
   JSI_HOST_FUNCTION(encodeToBase64) {
-    // Get optional parameters
-    auto format =
-        count >= 1 ? static_cast<SkEncodedImageFormat>(arguments[0].asNumber())
-                   : SkEncodedImageFormat::kPNG;
-
-    auto quality = count == 2 ? arguments[1].asNumber() : 100.0;
-    auto image = getObject();
-    if (image->isTextureBacked()) {
-      image = image->makeNonTextureImage();
-    }
-    sk_sp<SkData> data;
-    if (format == SkEncodedImageFormat::kJPEG) {
-      SkJpegEncoder::Options options;
-      options.fQuality = quality;
-      data = SkJpegEncoder::Encode(nullptr, image.get(), options);
-    } else {
-      SkPngEncoder::Options options;
-      data = SkPngEncoder::Encode(nullptr, image.get(), options);
+    auto options = getEncodeOptions(arguments, count);
+    SkDynamicMemoryWStream stream;
+    if (!encode(getRasterImage(), options, &stream)) {
+      return jsi::Value::null();
     }
+    auto data = stream.detachAsData();
+    // Encode straight into the string passed to JS
     auto len = SkBase64::Encode(data->bytes(), data->size(), nullptr);
-    auto buffer = std::string(len, 0);
-    SkBase64::Encode(data->bytes(), data->size(),
-                     reinterpret_cast<void *>(&buffer[0]));
-    return jsi::String::createFromAscii(runtime, buffer);
+    auto buffer = SkData::MakeUninitialized(len);
+    SkBase64::Encode(data->bytes(), data->size(), buffer->writable_data());
+    return jsi::String::createFromAscii(
+        runtime, static_cast<const char *>(buffer->data()), len);
+  }
+
+  JSI_HOST_FUNCTION(encodeAsync) {
+    auto options = getEncodeOptions(runtime, count > 0 ? arguments[0]
+                                                       : jsi::Value());
+    auto image = getRasterImage();
+    auto context = getContext();
+    return RNJsi::JsiPromises::createPromiseAsJSIValue(
+        runtime,
+        [context = std::move(context), image = std::move(image), options](
+            jsi::Runtime &runtime,
+            std::shared_ptr<RNJsi::JsiPromises::Promise> promise) -> void {
+          context->runInBackground([&runtime, context, image, options,
+                                    promise = std::move(promise)]() {
+            SkDynamicMemoryWStream stream;
+            sk_sp<SkData> data;
+            if (encode(image, options, &stream)) {
+              data = stream.detachAsData();
+            }
+            context->runOnJavascriptThread([&runtime, promise,
+                                            data = std::move(data)]() mutable {
+              if (data == nullptr) {
+                promise->resolve(jsi::Value::null());
+                return;
+              }
+              // Passes the only reference so that the bytes are not copied
+              promise->resolve(
+                  JsiSkData::toUint8Array(runtime, std::move(data)));
+            });
+          });
+        });
+  }
+
+  JSI_HOST_FUNCTION(encodeToFileAsync) {
+    auto path = arguments[0].asString(runtime).utf8(runtime);
+    static const std::string fileScheme = "file://";
+    if (path.compare(0, fileScheme.size(), fileScheme) == 0) {
+      path = path.substr(fileScheme.size());
+    }
+    auto options = getEncodeOptions(runtime, count > 1 ? arguments[1]
+                                                       : jsi::Value());
+    auto image = getRasterImage();
+    auto context = getContext();
+    return RNJsi::JsiPromises::createPromiseAsJSIValue(
+        runtime,
+        [context = std::move(context), image = std::move(image), options,
+         path = std::move(path)](
+            jsi::Runtime &runtime,
+            std::shared_ptr<RNJsi::JsiPromises::Promise> promise) -> void {
+          context->runInBackground([&runtime, context, image, options, path,
+                                    promise = std::move(promise)]() {
+            auto opened = false;
+            auto success = false;
+            {
+              // Written to the file while encoding, without a copy in memory
+              SkFILEWStream stream(path.c_str());
+              opened = stream.isValid();
+              success = opened && encode(image, options, &stream);
+              stream.flush();
+            }
+            if (opened && !success) {
+              // Don't leave a truncated file behind
+              std::remove(path.c_str());
+            }
+            context->runOnJavascriptThread([promise, success]() {
+              promise->resolve(jsi::Value(success));
+            });
+          });
+        });
   }
 
   JSI_HOST_FUNCTION(makeNonTextureImage) {
@@ -139,6 +192,8 @@ public:
                        JSI_EXPORT_FUNC(JsiSkImage, makeShaderCubic),
                        JSI_EXPORT_FUNC(JsiSkImage, encodeToBytes),
                        JSI_EXPORT_FUNC(JsiSkImage, encodeToBase64),
+                       JSI_EXPORT_FUNC(JsiSkImage, encodeAsync),
+                       JSI_EXPORT_FUNC(JsiSkImage, encodeToFileAsync),
                        JSI_EXPORT_FUNC(JsiSkImage, makeNonTextureImage),
                        JSI_EXPORT_FUNC(JsiSkImage, dispose))
 
@@ -146,6 +201,149 @@ public:
              const sk_sp<SkImage> image)
       : JsiSkWrappingSkPtrHostObject<SkImage>(std::move(context),
                                               std::move(image)) {}
+
+  /**
+   Encodes the image to the stream, scaled first if the options have a size.
+   Images backed by a texture must have been read back before. Can be called
+   from any thread.
+   */
+  static bool encode(sk_sp<SkImage> image, const ImageEncodeOptions &options,
+                     SkWStream *stream) {
+    // Decodes lazy images, returns raster images as they are
+    auto raster = image->makeRasterImage();
+    SkPixmap pixmap;
+    if (raster == nullptr || !raster->peekPixels(&pixmap)) {
+      return false;
+    }
+
+    SkBitmap scaled;
+    if (options.width > 0 || options.height > 0) {
+      // A missing dimension keeps the aspect ratio of the image
+      auto width = options.width > 0
+                       ? options.width
+                       : SkScalarRoundToInt(static_cast<float>(
+                             options.height * pixmap.width()) /
+                                            pixmap.height());
+      auto height = options.height > 0
+                        ? options.height
+                        : SkScalarRoundToInt(static_cast<float>(
+                              options.width * pixmap.height()) /
+                                             pixmap.width());
+      SkSamplingOptions sampling(SkCubicResampler::Mitchell());
+      if (!scaled.tryAllocPixels(pixmap.info().makeWH(width, height)) ||
+          !pixmap.scalePixels(scaled.pixmap(), sampling)) {
+        return false;
+      }
+      pixmap = scaled.pixmap();
+    }
+
+    switch (options.format) {
+    case SkEncodedImageFormat::kJPEG: {
+      SkJpegEncoder::Options jpegOptions;
+      jpegOptions.fQuality = options.quality;
+      return SkJpegEncoder::Encode(stream, pixmap, jpegOptions);
+    }
+    case SkEncodedImageFormat::kWEBP: {
+      SkWebpEncoder::Options webpOptions;
+      webpOptions.fCompression =
+          options.lossless ? SkWebpEncoder::Compression::kLossless
+                           : SkWebpEncoder::Compression::kLossy;
+      webpOptions.fQuality = options.quality;
+      return SkWebpEncoder::Encode(stream, pixmap, webpOptions);
+    }
+    default: {
+      SkPngEncoder::Options pngOptions;
+      pngOptions.fZLibLevel = options.zlibLevel;
+      pngOptions.fFilterFlags =
+          static_cast<SkPngEncoder::FilterFlag>(options.pngFilters);
+      return SkPngEncoder::Encode(stream, pixmap, pngOptions);
+    }
+    }
+  }
+
+private:
+  /**
+   Returns the value rounded down and clamped to the range, or the fallback if
+   it is not a number
+   */
+  static int clamp(double value, int min, int max, int fallback) {
+    if (std::isnan(value)) {
+      return fallback;
+    }
+    return static_cast<int>(
+        std::min<double>(std::max<double>(value, min), max));
+  }
+
+  /**
+   Returns the image, read back from the GPU if it is backed by a texture.
+   Called on the Javascript thread, where the GPU context of the image is.
+   */
+  sk_sp<SkImage> getRasterImage() {
+    auto image = getObject();
+    if (image->isTextureBacked()) {
+      image = image->makeNonTextureImage();
+    }
+    return image;
+  }
+
+  /**
+   Reads the format and quality arguments of the synchronous encode functions
+   */
+  static ImageEncodeOptions getEncodeOptions(const jsi::Value *arguments,
+                                             size_t count) {
+    ImageEncodeOptions options;
+    if (count >= 1 && arguments[0].isNumber()) {
+      options.format =
+          static_cast<SkEncodedImageFormat>(arguments[0].asNumber());
+    }
+    if (count >= 2 && arguments[1].isNumber()) {
+      options.quality =
+          clamp(arguments[1].asNumber(), 0, 100, options.quality);
+    }
+    return options;
+  }
+
+  /**
+   Reads the options object of the asynchronous encode functions. The quality
+   and compression level are clamped to their range, invalid PNG filters
+   throw.
+   */
+  static ImageEncodeOptions getEncodeOptions(jsi::Runtime &runtime,
+                                             const jsi::Value &value) {
+    ImageEncodeOptions options;
+    if (!value.isObject()) {
+      return options;
+    }
+    auto object = value.asObject(runtime);
+    auto getNumber = [&](const char *name, int min, int max, int *result) {
+      auto property = object.getProperty(runtime, name);
+      if (property.isNumber()) {
+        *result = clamp(property.asNumber(), min, max, *result);
+      }
+    };
+    int format = static_cast<int>(options.format);
+    getNumber("format", 0, INT_MAX, &format);
+    options.format = static_cast<SkEncodedImageFormat>(format);
+    getNumber("quality", 0, 100, &options.quality);
+    getNumber("zlibLevel", 0, 9, &options.zlibLevel);
+    getNumber("width", 0, INT_MAX, &options.width);
+    getNumber("height", 0, INT_MAX, &options.height);
+    auto filters = object.getProperty(runtime, "pngFilters");
+    if (!filters.isUndefined()) {
+      constexpr auto all = static_cast<int>(SkPngEncoder::FilterFlag::kAll);
+      auto mask = filters.isNumber() ? filters.asNumber() : -1;
+      if (!(mask >= 0 && mask <= all) || mask != std::floor(mask) ||
+          (static_cast<int>(mask) & ~all) != 0) {
+        throw jsi::JSError(runtime,
+                           "pngFilters must be a combination of PngFilter "
+                           "values.");
+      }
+      options.pngFilters = static_cast<int>(mask);
+    }
+    auto lossless = object.getProperty(runtime, "lossless");
+    options.lossless = lossless.isBool() && lossless.getBool();
+    return options;
+  }
 };
 
 } // namespace RNSkia
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <exception>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include <jsi/jsi.h>
 
+#include "JsiPromises.h"
 #include "JsiSkHostObjects.h"
 #include "JsiSkMatrix.h"
 #include "JsiSkPoint.h"
@@ -79,9 +82,8 @@ public:
     auto pointsSize = jsiPoints.size(runtime);
     points.reserve(pointsSize);
     for (int i = 0; i < pointsSize; i++) {
-      std::shared_ptr<SkPoint> point = JsiSkPoint::fromValue(
-          runtime, jsiPoints.getValueAtIndex(runtime, i).asObject(runtime));
-      points.push_back(*point.get());
+      points.push_back(
+          JsiSkPoint::getPoint(runtime, jsiPoints.getValueAtIndex(runtime, i)));
     }
     getObject()->addPoly(points.data(), static_cast<int>(points.size()), close);
     return thisValue.getObject(runtime);
@@ -199,21 +201,18 @@ public:
     SkScalar on = arguments[0].asNumber();
     SkScalar off = arguments[1].asNumber();
     auto phase = arguments[2].asNumber();
-    SkScalar intervals[] = {on, off};
-    auto pe = SkDashPathEffect::Make(intervals, 2, phase);
-    if (!pe) {
-      // TODO: SkDebugf("Invalid args to dash()\n");
-      return jsi::Value(false);
-    }
-    SkStrokeRec rec(SkStrokeRec::InitStyle::kHairline_InitStyle);
-    SkPath &path = *getObject();
-    // TODO: why we don't need to swap here? In trim() which is the same
-    // API, we need to swap
-    if (pe->filterPath(&path, path, &rec, nullptr)) {
-      return jsi::Value(true);
-    }
-    SkDebugf("Could not make dashed path\n");
-    return jsi::Value(false);
+    return jsi::Value(dashPath(getObject().get(), on, off, phase));
+  }
+
+  JSI_HOST_FUNCTION(dashAsync) {
+    SkScalar on = arguments[0].asNumber();
+    SkScalar off = arguments[1].asNumber();
+    SkScalar phase = arguments[2].asNumber();
+    return makePathAsync(runtime, getContext(),
+                         [path = *getObject(), on, off, phase](SkPath *result) {
+                           *result = path;
+                           return dashPath(result, on, off, phase);
+                         });
   }
 
   JSI_HOST_FUNCTION(equals) {
@@ -254,66 +253,53 @@ public:
 
   JSI_HOST_FUNCTION(stroke) {
     auto path = *getObject();
-    auto opts = arguments[0].asObject(runtime);
-    SkPaint p;
-    p.setStyle(SkPaint::kStroke_Style);
-
-    auto jsiCap = opts.getProperty(runtime, "cap");
-    if (!jsiCap.isUndefined()) {
-      auto cap = (SkPaint::Cap)jsiCap.asNumber();
-      p.setStrokeCap(cap);
-    }
-
-    auto jsiJoin = opts.getProperty(runtime, "join");
-    if (!jsiJoin.isUndefined()) {
-      auto join = (SkPaint::Join)jsiJoin.asNumber();
-      p.setStrokeJoin(join);
-    }
-
-    auto jsiWidth = opts.getProperty(runtime, "width");
-    if (!jsiWidth.isUndefined()) {
-      auto width = jsiWidth.asNumber();
-      p.setStrokeWidth(width);
-    }
-
-    auto jsiMiterLimit = opts.getProperty(runtime, "miter_limit");
-    if (!jsiMiterLimit.isUndefined()) {
-      auto miter_limit = opts.getProperty(runtime, "miter_limit").asNumber();
-      p.setStrokeMiter(miter_limit);
-    }
-
-    auto jsiPrecision = opts.getProperty(runtime, "precision");
-    auto precision = jsiPrecision.isUndefined() ? 1 : jsiPrecision.asNumber();
+    SkScalar precision;
+    auto paint = getStrokePaint(runtime, arguments[0], &precision);
     auto result =
-        skpathutils::FillPathWithPaint(path, p, &path, nullptr, precision);
+        skpathutils::FillPathWithPaint(path, paint, &path, nullptr, precision);
     if (result) {
       getObject()->swap(path);
     }
     return result ? thisValue.getObject(runtime) : jsi::Value::null();
   }
 
+  JSI_HOST_FUNCTION(strokeAsync) {
+    SkScalar precision;
+    auto paint = getStrokePaint(
+        runtime, count > 0 ? arguments[0] : jsi::Value::undefined(),
+        &precision);
+    return makePathAsync(
+        runtime, getContext(),
+        [path = *getObject(), paint, precision](SkPath *result) {
+          return skpathutils::FillPathWithPaint(path, paint, result, nullptr,
+                                                precision);
+        });
+  }
+
   JSI_HOST_FUNCTION(trim) {
     auto start = arguments[0].asNumber();
     auto end = arguments[1].asNumber();
     auto isComplement = arguments[2].getBool();
     auto path = *getObject();
-    auto mode = isComplement ? SkTrimPathEffect::Mode::kInverted
-                             : SkTrimPathEffect::Mode::kNormal;
-    auto pe = SkTrimPathEffect::Make(start, end, mode);
-    if (!pe) {
-      // SkDebugf("Invalid args to trim(): startT and stopT must be in
-      // [0,1]\n");
-      return jsi::Value::null();
-    }
-    SkStrokeRec rec(SkStrokeRec::InitStyle::kHairline_InitStyle);
-    if (pe->filterPath(&path, path, &rec, nullptr)) {
+    if (trimPath(&path, start, end, isComplement)) {
       getObject()->swap(path);
       return thisValue.getObject(runtime);
     }
-    SkDebugf("Could not trim path\n");
     return jsi::Value::null();
   }
 
+  JSI_HOST_FUNCTION(trimAsync) {
+    SkScalar start = arguments[0].asNumber();
+    SkScalar end = arguments[1].asNumber();
+    auto isComplement = arguments[2].getBool();
+    return makePathAsync(
+        runtime, getContext(),
+        [path = *getObject(), start, end, isComplement](SkPath *result) {
+          *result = path;
+          return trimPath(result, start, end, isComplement);
+        });
+  }
+
   JSI_HOST_FUNCTION(getPoint) {
     auto index = arguments[0].asNumber();
     auto point = getObject()->getPoint(index);
@@ -453,6 +439,13 @@ public:
     return jsi::Value(false);
   }
 
+  JSI_HOST_FUNCTION(simplifyAsync) {
+    return makePathAsync(runtime, getContext(),
+                         [path = *getObject()](SkPath *result) {
+                           return Simplify(path, result);
+                         });
+  }
+
   JSI_HOST_FUNCTION(countPoints) {
     auto points = getObject()->countPoints();
     return jsi::Value(points);
@@ -475,6 +468,16 @@ public:
     return jsi::Value(false);
   }
 
+  JSI_HOST_FUNCTION(opAsync) {
+    auto path2 = JsiSkPath::fromValue(runtime, arguments[0]);
+    auto pathOp = SkPathOp(arguments[1].asNumber());
+    return makePathAsync(
+        runtime, getContext(),
+        [one = *getObject(), two = *path2, pathOp](SkPath *result) {
+          return Op(one, two, pathOp, result);
+        });
+  }
+
   JSI_HOST_FUNCTION(isInterpolatable) {
     auto path2 = JsiSkPath::fromValue(runtime, arguments[0]);
     return getObject()->isInterpolatable(*path2);
@@ -537,13 +540,16 @@ public:
       JSI_EXPORT_FUNC(JsiSkPath, getBounds),
       JSI_EXPORT_FUNC(JsiSkPath, conicTo), JSI_EXPORT_FUNC(JsiSkPath, rConicTo),
       JSI_EXPORT_FUNC(JsiSkPath, contains), JSI_EXPORT_FUNC(JsiSkPath, dash),
+      JSI_EXPORT_FUNC(JsiSkPath, dashAsync),
       JSI_EXPORT_FUNC(JsiSkPath, equals),
       JSI_EXPORT_FUNC(JsiSkPath, getFillType),
       JSI_EXPORT_FUNC(JsiSkPath, setFillType),
       JSI_EXPORT_FUNC(JsiSkPath, setIsVolatile),
       JSI_EXPORT_FUNC(JsiSkPath, isVolatile),
       JSI_EXPORT_FUNC(JsiSkPath, transform), JSI_EXPORT_FUNC(JsiSkPath, stroke),
-      JSI_EXPORT_FUNC(JsiSkPath, trim), JSI_EXPORT_FUNC(JsiSkPath, getPoint),
+      JSI_EXPORT_FUNC(JsiSkPath, strokeAsync), JSI_EXPORT_FUNC(JsiSkPath, trim),
+      JSI_EXPORT_FUNC(JsiSkPath, trimAsync),
+      JSI_EXPORT_FUNC(JsiSkPath, getPoint),
       JSI_EXPORT_FUNC(JsiSkPath, toSVGString),
       JSI_EXPORT_FUNC(JsiSkPath, makeAsWinding),
       JSI_EXPORT_FUNC(JsiSkPath, isEmpty), JSI_EXPORT_FUNC(JsiSkPath, offset),
@@ -555,8 +561,9 @@ public:
       JSI_EXPORT_FUNC(JsiSkPath, addCircle),
       JSI_EXPORT_FUNC(JsiSkPath, getLastPt), JSI_EXPORT_FUNC(JsiSkPath, close),
       JSI_EXPORT_FUNC(JsiSkPath, simplify),
+      JSI_EXPORT_FUNC(JsiSkPath, simplifyAsync),
       JSI_EXPORT_FUNC(JsiSkPath, countPoints), JSI_EXPORT_FUNC(JsiSkPath, copy),
-      JSI_EXPORT_FUNC(JsiSkPath, op),
+      JSI_EXPORT_FUNC(JsiSkPath, op), JSI_EXPORT_FUNC(JsiSkPath, opAsync),
       JSI_EXPORT_FUNC(JsiSkPath, isInterpolatable),
       JSI_EXPORT_FUNC(JsiSkPath, interpolate),
       JSI_EXPORT_FUNC(JsiSkPath, toCmds), JSI_EXPORT_FUNC(JsiSkPath, dispose))
@@ -579,6 +586,130 @@ public:
         runtime,
         std::make_shared<JsiSkPath>(std::move(context), std::move(path)));
   }
+
+  /**
+   Returns a promise for the path computed by the function on a background
+   thread, or null if the function returns false. The promise is rejected if
+   the function throws. The function must only use its own copies of the
+   input paths.
+   */
+  template <typename ComputeFn>
+  static jsi::Value
+  makePathAsync(jsi::Runtime &runtime,
+                std::shared_ptr<RNSkPlatformContext> context,
+                ComputeFn &&compute) {
+    return RNJsi::JsiPromises::createPromiseAsJSIValue(
+        runtime,
+        [context = std::move(context),
+         compute = std::forward<ComputeFn>(compute)](
+            jsi::Runtime &runtime,
+            std::shared_ptr<RNJsi::JsiPromises::Promise> promise) -> void {
+          context->runInBackground([&runtime, context, compute,
+                                    promise = std::move(promise)]() {
+            SkPath result;
+            auto success = false;
+            auto failed = false;
+            std::string error;
+            try {
+              success = compute(&result);
+            } catch (const std::exception &e) {
+              failed = true;
+              error = e.what();
+            }
+            context->runOnJavascriptThread([&runtime, context, promise,
+                                            success, result, failed,
+                                            error = std::move(error)]() {
+              if (failed) {
+                promise->reject(error);
+                return;
+              }
+              if (!success) {
+                promise->resolve(jsi::Value::null());
+                return;
+              }
+              promise->resolve(JsiSkPath::toValue(runtime, context, result));
+            });
+          });
+        });
+  }
+
+private:
+  static SkPaint getStrokePaint(jsi::Runtime &runtime, const jsi::Value &value,
+                                SkScalar *precision) {
+    SkPaint p;
+    p.setStyle(SkPaint::kStroke_Style);
+    *precision = 1;
+    if (!value.isObject()) {
+      return p;
+    }
+    auto opts = value.asObject(runtime);
+
+    auto jsiCap = opts.getProperty(runtime, "cap");
+    if (!jsiCap.isUndefined()) {
+      auto cap = (SkPaint::Cap)jsiCap.asNumber();
+      p.setStrokeCap(cap);
+    }
+
+    auto jsiJoin = opts.getProperty(runtime, "join");
+    if (!jsiJoin.isUndefined()) {
+      auto join = (SkPaint::Join)jsiJoin.asNumber();
+      p.setStrokeJoin(join);
+    }
+
+    auto jsiWidth = opts.getProperty(runtime, "width");
+    if (!jsiWidth.isUndefined()) {
+      auto width = jsiWidth.asNumber();
+      p.setStrokeWidth(width);
+    }
+
+    auto jsiMiterLimit = opts.getProperty(runtime, "miter_limit");
+    if (!jsiMiterLimit.isUndefined()) {
+      auto miter_limit = opts.getProperty(runtime, "miter_limit").asNumber();
+      p.setStrokeMiter(miter_limit);
+    }
+
+    auto jsiPrecision = opts.getProperty(runtime, "precision");
+    if (!jsiPrecision.isUndefined()) {
+      *precision = jsiPrecision.asNumber();
+    }
+    return p;
+  }
+
+  static bool dashPath(SkPath *path, SkScalar on, SkScalar off,
+                       SkScalar phase) {
+    SkScalar intervals[] = {on, off};
+    auto pe = SkDashPathEffect::Make(intervals, 2, phase);
+    if (!pe) {
+      // TODO: SkDebugf("Invalid args to dash()\n");
+      return false;
+    }
+    SkStrokeRec rec(SkStrokeRec::InitStyle::kHairline_InitStyle);
+    // TODO: why we don't need to swap here? In trim() which is the same
+    // API, we need to swap
+    if (pe->filterPath(path, *path, &rec, nullptr)) {
+      return true;
+    }
+    SkDebugf("Could not make dashed path\n");
+    return false;
+  }
+
+  static bool trimPath(SkPath *path, SkScalar start, SkScalar end,
+                       bool isComplement) {
+    auto mode = isComplement ? SkTrimPathEffect::Mode::kInverted
+                             : SkTrimPathEffect::Mode::kNormal;
+    auto pe = SkTrimPathEffect::Make(start, end, mode);
+    if (!pe) {
+      // SkDebugf("Invalid args to trim(): startT and stopT must be in
+      // [0,1]\n");
+      return false;
+    }
+    SkStrokeRec rec(SkStrokeRec::InitStyle::kHairline_InitStyle);
+    if (pe->filterPath(path, *path, &rec, nullptr)) {
+      return true;
+    }
+    SkDebugf("Could not trim path\n");
+    return false;
+  }
 };
 
 } // namespace RNSkia
@@ -2,11 +2,13 @@
 
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <jsi/jsi.h>
 
 #include "JsiSkHostObjects.h"
 #include "JsiSkPathEffect.h"
+#include "RNSkPathCache.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
@@ -38,15 +40,16 @@ public:
 
   JSI_HOST_FUNCTION(MakeFromSVGString) {
     auto svgString = arguments[0].asString(runtime).utf8(runtime);
-    SkPath result;
+    auto path = RNSkPathCache::getInstance().getPath(svgString);
 
-    if (!SkParsePath::FromSVGString(svgString.c_str(), &result)) {
+    if (path == nullptr) {
       throw jsi::JSError(runtime, "Could not parse Svg path");
       return jsi::Value(nullptr);
     }
 
+    // The returned path is mutable, copying shares the points until written
     return jsi::Object::createFromHostObject(
-        runtime, std::make_shared<JsiSkPath>(getContext(), std::move(result)));
+        runtime, std::make_shared<JsiSkPath>(getContext(), SkPath(*path)));
   }
 
   JSI_HOST_FUNCTION(MakeFromOp) {
@@ -62,6 +65,43 @@ public:
         runtime, std::make_shared<JsiSkPath>(getContext(), std::move(result)));
   }
 
+  JSI_HOST_FUNCTION(MakeFromOpAsync) {
+    auto one = *JsiSkPath::fromValue(runtime, arguments[0]);
+    auto two = *JsiSkPath::fromValue(runtime, arguments[1]);
+    auto op = SkPathOp(arguments[2].asNumber());
+    return JsiSkPath::makePathAsync(
+        runtime, getContext(),
+        [one = std::move(one), two = std::move(two), op](SkPath *result) {
+          return Op(one, two, op, result);
+        });
+  }
+
+  JSI_HOST_FUNCTION(MakeFromOpsAsync) {
+    auto jsiPaths = arguments[0].asObject(runtime).asArray(runtime);
+    auto op = SkPathOp(arguments[1].asNumber());
+    std::vector<SkPath> paths;
+    paths.reserve(jsiPaths.size(runtime));
+    for (size_t i = 0; i < jsiPaths.size(runtime); i++) {
+      paths.push_back(
+          *JsiSkPath::fromValue(runtime, jsiPaths.getValueAtIndex(runtime, i)));
+    }
+    return JsiSkPath::makePathAsync(
+        runtime, getContext(),
+        [paths = std::move(paths), op](SkPath *result) {
+          if (paths.empty()) {
+            return false;
+          }
+          // The builder combines all paths in one pass, which is much faster
+          // than applying the operations one by one for unions
+          SkOpBuilder builder;
+          builder.add(paths[0], kUnion_SkPathOp);
+          for (size_t i = 1; i < paths.size(); i++) {
+            builder.add(paths[i], op);
+          }
+          return builder.resolve(result);
+        });
+  }
+
   JSI_HOST_FUNCTION(MakeFromCmds) {
     SkPath path;
     auto cmds = arguments[0].asObject(runtime).asArray(runtime);
@@ -160,11 +200,24 @@ public:
         runtime, std::make_shared<JsiSkPath>(getContext(), std::move(path)));
   }
 
+  JSI_HOST_FUNCTION(getCacheStats) {
+    auto stats = RNSkPathCache::getInstance().getStats();
+    auto result = jsi::Object(runtime);
+    result.setProperty(runtime, "hits", static_cast<double>(stats.hits));
+    result.setProperty(runtime, "misses", static_cast<double>(stats.misses));
+    result.setProperty(runtime, "entries", static_cast<double>(stats.entries));
+    result.setProperty(runtime, "bytes", static_cast<double>(stats.bytes));
+    return result;
+  }
+
   JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(JsiSkPathFactory, Make),
                        JSI_EXPORT_FUNC(JsiSkPathFactory, MakeFromSVGString),
                        JSI_EXPORT_FUNC(JsiSkPathFactory, MakeFromOp),
+                       JSI_EXPORT_FUNC(JsiSkPathFactory, MakeFromOpAsync),
+                       JSI_EXPORT_FUNC(JsiSkPathFactory, MakeFromOpsAsync),
                        JSI_EXPORT_FUNC(JsiSkPathFactory, MakeFromCmds),
-                       JSI_EXPORT_FUNC(JsiSkPathFactory, MakeFromText))
+                       JSI_EXPORT_FUNC(JsiSkPathFactory, MakeFromText),
+                       JSI_EXPORT_FUNC(JsiSkPathFactory, getCacheStats))
 
   explicit JsiSkPathFactory(std::shared_ptr<RNSkPlatformContext> context)
       : JsiSkHostObject(std::move(context)) {}
@@ -1,17 +1,23 @@
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <utility>
 
+#include "JsiPromises.h"
 #include "JsiSkColorFilter.h"
 #include "JsiSkData.h"
 #include "JsiSkHostObjects.h"
 #include "JsiSkPicture.h"
+#include "RNSkPictureCache.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
 
 #include "SkData.h"
 #include "SkPicture.h"
+#include "SkStream.h"
 
 #pragma clang diagnostic pop
 
@@ -25,15 +31,9 @@ public:
     if (!arguments[0].isObject()) {
       throw jsi::JSError(runtime, "Expected arraybuffer as first parameter");
     }
-    auto array = arguments[0].asObject(runtime);
-    jsi::ArrayBuffer buffer =
-        array.getProperty(runtime, jsi::PropNameID::forAscii(runtime, "buffer"))
-            .asObject(runtime)
-            .getArrayBuffer(runtime);
-
-    sk_sp<SkData> data =
-        SkData::MakeWithCopy(buffer.data(runtime), buffer.size(runtime));
-    auto picture = SkPicture::MakeFromData(data.get());
+    // Deserialized synchronously, the cache copies the bytes it keeps
+    auto data = JsiSkData::viewArrayBuffer(runtime, arguments[0]);
+    auto picture = RNSkPictureCache::getInstance().getPicture(data);
     if (picture != nullptr) {
       return jsi::Object::createFromHostObject(
           runtime, std::make_shared<JsiSkPicture>(getContext(), picture));
@@ -42,10 +42,96 @@ public:
     }
   }
 
-  JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(JsiSkPictureFactory, MakePicture))
+  JSI_HOST_FUNCTION(MakePictureFromURI) {
+    auto uri = arguments[0].asString(runtime).utf8(runtime);
+    auto context = getContext();
+    return RNJsi::JsiPromises::createPromiseAsJSIValue(
+        runtime,
+        [context = std::move(context), uri = std::move(uri)](
+            jsi::Runtime &runtime,
+            std::shared_ptr<RNJsi::JsiPromises::Promise> promise) -> void {
+          // Called on the loading thread, deserializes there as well
+          auto resolve = [&runtime, context,
+                          promise = std::move(promise)](sk_sp<SkData> data) {
+            auto picture = RNSkPictureCache::getInstance().getPicture(data);
+            context->runOnJavascriptThread(
+                [&runtime, context, promise, picture]() {
+                  if (picture == nullptr) {
+                    promise->resolve(jsi::Value::null());
+                    return;
+                  }
+                  promise->resolve(jsi::Object::createFromHostObject(
+                      runtime,
+                      std::make_shared<JsiSkPicture>(context, picture)));
+                });
+          };
+
+          auto path = getFilePath(uri);
+          if (path.empty()) {
+            loadFromStream(context, uri, resolve);
+            return;
+          }
+          context->runInBackground([context, uri, path, resolve]() {
+            // Local files are memory mapped instead of read into a copy
+            auto data = SkData::MakeFromFileName(path.c_str());
+            if (data != nullptr) {
+              resolve(std::move(data));
+            } else {
+              loadFromStream(context, uri, resolve);
+            }
+          });
+        });
+  }
+
+  JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(JsiSkPictureFactory, MakePicture),
+                       JSI_EXPORT_FUNC(JsiSkPictureFactory,
+                                       MakePictureFromURI))
 
   explicit JsiSkPictureFactory(std::shared_ptr<RNSkPlatformContext> context)
       : JsiSkHostObject(context) {}
+
+private:
+  /**
+   Returns the path of a local file uri or absolute path, or an empty string
+   for the uris that must be loaded by the platform (bundled assets, http)
+   */
+  static std::string getFilePath(const std::string &uri) {
+    static const std::string fileScheme = "file://";
+    if (uri.compare(0, fileScheme.size(), fileScheme) == 0) {
+      return uri.substr(fileScheme.size());
+    }
+    if (!uri.empty() && uri[0] == '/') {
+      return uri;
+    }
+    return "";
+  }
+
+  static void
+  loadFromStream(std::shared_ptr<RNSkPlatformContext> context,
+                 const std::string &uri,
+                 const std::function<void(sk_sp<SkData>)> &resolve) {
+    context->performStreamOperation(
+        uri, [resolve](std::unique_ptr<SkStreamAsset> stream) {
+          if (stream == nullptr) {
+            resolve(nullptr);
+            return;
+          }
+          auto memory = stream->getMemoryBase();
+          if (memory == nullptr) {
+            resolve(SkData::MakeFromStream(stream.get(), stream->getLength()));
+            return;
+          }
+          // Memory streams already hold the bytes, keep the stream alive
+          // with the data instead of copying them
+          auto length = stream->getLength();
+          resolve(SkData::MakeWithProc(
+              memory, length,
+              [](const void *, void *stream) {
+                delete static_cast<SkStreamAsset *>(stream);
+              },
+              stream.release()));
+        });
+  }
 };
 
 } // namespace RNSkia
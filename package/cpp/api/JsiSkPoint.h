@@ -45,12 +45,24 @@ public:
     if (object.isHostObject(runtime)) {
       return object.asHostObject<JsiSkPoint>(runtime)->getObject();
     } else {
-      auto x = object.getProperty(runtime, "x").asNumber();
-      auto y = object.getProperty(runtime, "y").asNumber();
-      return std::make_shared<SkPoint>(SkPoint::Make(x, y));
+      return std::make_shared<SkPoint>(getPoint(runtime, obj));
     }
   }
 
+  /**
+  Returns a copy of the point represented by a host object or a plain {x, y}
+  object. Use this in loops to avoid allocating a shared pointer per element.
+ */
+  static SkPoint getPoint(jsi::Runtime &runtime, const jsi::Value &obj) {
+    const auto &object = obj.asObject(runtime);
+    if (object.isHostObject(runtime)) {
+      return *object.asHostObject<JsiSkPoint>(runtime)->getObject();
+    }
+    auto x = object.getProperty(runtime, "x").asNumber();
+    auto y = object.getProperty(runtime, "y").asNumber();
+    return SkPoint::Make(x, y);
+  }
+
   /**
   Returns the jsi object from a host object of this type
  */
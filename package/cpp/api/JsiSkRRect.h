@@ -59,14 +59,26 @@ public:
           .asHostObject<JsiSkRRect>(runtime)
           ->getObject();
     } else {
-      auto rect =
-          JsiSkRect::fromValue(runtime, object.getProperty(runtime, "rect"));
-      auto rx = object.getProperty(runtime, "rx").asNumber();
-      auto ry = object.getProperty(runtime, "ry").asNumber();
-      return std::make_shared<SkRRect>(SkRRect::MakeRectXY(*rect, rx, ry));
+      return std::make_shared<SkRRect>(getRRect(runtime, obj));
     }
   }
 
+  /**
+    Returns a copy of the rounded rect represented by a host object or a plain
+    {rect, rx, ry} object without allocating.
+   */
+  static SkRRect getRRect(jsi::Runtime &runtime, const jsi::Value &obj) {
+    const auto &object = obj.asObject(runtime);
+    if (object.isHostObject(runtime)) {
+      return *object.asHostObject<JsiSkRRect>(runtime)->getObject();
+    }
+    auto rect =
+        JsiSkRect::getRect(runtime, object.getProperty(runtime, "rect"));
+    auto rx = object.getProperty(runtime, "rx").asNumber();
+    auto ry = object.getProperty(runtime, "ry").asNumber();
+    return SkRRect::MakeRectXY(rect, rx, ry);
+  }
+
   /**
     Returns the jsi object from a host object of this type
    */
@@ -88,10 +100,10 @@ public:
   createCtor(std::shared_ptr<RNSkPlatformContext> context) {
     return JSI_HOST_FUNCTION_LAMBDA {
       // Set up the rect
-      auto rect = JsiSkRect::fromValue(runtime, arguments[0]).get();
+      auto rect = JsiSkRect::getRect(runtime, arguments[0]);
       auto rx = arguments[1].asNumber();
       auto ry = arguments[2].asNumber();
-      auto rrect = SkRRect::MakeRectXY(*rect, rx, ry);
+      auto rrect = SkRRect::MakeRectXY(rect, rx, ry);
       // Return the newly constructed object
       return jsi::Object::createFromHostObject(
           runtime,
@@ -57,16 +57,27 @@ public:
     if (object.isHostObject(runtime)) {
       return object.asHostObject<JsiSkRSXform>(runtime)->getObject();
     } else {
-      auto scos =
-          object.getArray(runtime).getValueAtIndex(runtime, 0).asNumber();
-      auto ssin =
-          object.getArray(runtime).getValueAtIndex(runtime, 1).asNumber();
-      auto tx = object.getArray(runtime).getValueAtIndex(runtime, 2).asNumber();
-      auto ty = object.getArray(runtime).getValueAtIndex(runtime, 3).asNumber();
-      return std::make_shared<SkRSXform>(SkRSXform::Make(scos, ssin, tx, ty));
+      return std::make_shared<SkRSXform>(getRSXform(runtime, obj));
     }
   }
 
+  /**
+  Returns a copy of the transform represented by a host object or a plain
+  [scos, ssin, tx, ty] array without allocating.
+ */
+  static SkRSXform getRSXform(jsi::Runtime &runtime, const jsi::Value &obj) {
+    const auto &object = obj.asObject(runtime);
+    if (object.isHostObject(runtime)) {
+      return *object.asHostObject<JsiSkRSXform>(runtime)->getObject();
+    }
+    auto array = object.getArray(runtime);
+    auto scos = array.getValueAtIndex(runtime, 0).asNumber();
+    auto ssin = array.getValueAtIndex(runtime, 1).asNumber();
+    auto tx = array.getValueAtIndex(runtime, 2).asNumber();
+    auto ty = array.getValueAtIndex(runtime, 3).asNumber();
+    return SkRSXform::Make(scos, ssin, tx, ty);
+  }
+
   /**
   Returns the jsi object from a host object of this type
  */
@@ -73,14 +73,26 @@ public:
     if (object.isHostObject(runtime)) {
       return object.asHostObject<JsiSkRect>(runtime)->getObject();
     } else {
-      auto x = object.getProperty(runtime, "x").asNumber();
-      auto y = object.getProperty(runtime, "y").asNumber();
-      auto width = object.getProperty(runtime, "width").asNumber();
-      auto height = object.getProperty(runtime, "height").asNumber();
-      return std::make_shared<SkRect>(SkRect::MakeXYWH(x, y, width, height));
+      return std::make_shared<SkRect>(getRect(runtime, obj));
     }
   }
 
+  /**
+    Returns a copy of the rect represented by a host object or a plain
+    {x, y, width, height} object without allocating.
+   */
+  static SkRect getRect(jsi::Runtime &runtime, const jsi::Value &obj) {
+    const auto &object = obj.asObject(runtime);
+    if (object.isHostObject(runtime)) {
+      return *object.asHostObject<JsiSkRect>(runtime)->getObject();
+    }
+    auto x = object.getProperty(runtime, "x").asNumber();
+    auto y = object.getProperty(runtime, "y").asNumber();
+    auto width = object.getProperty(runtime, "width").asNumber();
+    auto height = object.getProperty(runtime, "height").asNumber();
+    return SkRect::MakeXYWH(x, y, width, height);
+  }
+
   /**
     Returns the jsi object from a host object of this type
    */
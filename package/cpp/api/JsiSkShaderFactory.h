@@ -77,10 +77,8 @@ std::vector<SkScalar> getPositions(jsi::Runtime &runtime,
 class JsiSkShaderFactory : public JsiSkHostObject {
 public:
   JSI_HOST_FUNCTION(MakeLinearGradient) {
-    auto p1 =
-        *JsiSkPoint::fromValue(runtime, arguments[0].asObject(runtime)).get();
-    auto p2 =
-        *JsiSkPoint::fromValue(runtime, arguments[1].asObject(runtime)).get();
+    auto p1 = JsiSkPoint::getPoint(runtime, arguments[0]);
+    auto p2 = JsiSkPoint::getPoint(runtime, arguments[1]);
     SkPoint pts[] = {p1, p2};
 
     std::vector<SkColor> colors = getColors(runtime, arguments[2]);
@@ -98,8 +96,7 @@ public:
   }
 
   JSI_HOST_FUNCTION(MakeRadialGradient) {
-    auto center =
-        *JsiSkPoint::fromValue(runtime, arguments[0].asObject(runtime)).get();
+    auto center = JsiSkPoint::getPoint(runtime, arguments[0]);
     auto r = arguments[1].asNumber();
 
     std::vector<SkColor> colors = getColors(runtime, arguments[2]);
@@ -138,12 +135,10 @@ public:
   }
 
   JSI_HOST_FUNCTION(MakeTwoPointConicalGradient) {
-    auto start =
-        *JsiSkPoint::fromValue(runtime, arguments[0].asObject(runtime)).get();
+    auto start = JsiSkPoint::getPoint(runtime, arguments[0]);
     auto startRadius = arguments[1].asNumber();
 
-    auto end =
-        *JsiSkPoint::fromValue(runtime, arguments[2].asObject(runtime)).get();
+    auto end = JsiSkPoint::getPoint(runtime, arguments[2]);
     auto endRadius = arguments[3].asNumber();
 
     std::vector<SkColor> colors = getColors(runtime, arguments[4]);
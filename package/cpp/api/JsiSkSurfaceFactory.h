@@ -8,6 +8,7 @@
 #include "JsiSkHostObjects.h"
 
 #include "JsiSkSurface.h"
+#include "RNSkSurfacePool.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
@@ -25,7 +26,8 @@ public:
   JSI_HOST_FUNCTION(Make) {
     auto width = static_cast<int>(arguments[0].asNumber());
     auto height = static_cast<int>(arguments[1].asNumber());
-    auto surface = SkSurface::MakeRasterN32Premul(width, height);
+    auto surface =
+        RNSkSurfacePool::getInstance().makeRasterSurface(width, height);
     if (surface == nullptr) {
       return jsi::Value::null();
     }
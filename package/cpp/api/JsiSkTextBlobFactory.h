@@ -59,9 +59,8 @@ public:
     int rsxformsSize = static_cast<int>(jsiRsxforms.size(runtime));
     rsxforms.reserve(rsxformsSize);
     for (int i = 0; i < rsxformsSize; i++) {
-      auto rsxform = JsiSkRSXform::fromValue(
-          runtime, jsiRsxforms.getValueAtIndex(runtime, i));
-      rsxforms.push_back(*rsxform);
+      rsxforms.push_back(JsiSkRSXform::getRSXform(
+          runtime, jsiRsxforms.getValueAtIndex(runtime, i)));
     }
     auto textBlob = SkTextBlob::MakeFromRSXform(str.c_str(), str.length(),
                                                 rsxforms.data(), *font);
@@ -85,9 +84,8 @@ public:
     int rsxformsSize = static_cast<int>(jsiRsxforms.size(runtime));
     rsxforms.reserve(rsxformsSize);
     for (int i = 0; i < rsxformsSize; i++) {
-      auto rsxform = JsiSkRSXform::fromValue(
-          runtime, jsiRsxforms.getValueAtIndex(runtime, i));
-      rsxforms.push_back(*rsxform);
+      rsxforms.push_back(JsiSkRSXform::getRSXform(
+          runtime, jsiRsxforms.getValueAtIndex(runtime, i)));
     }
     auto textBlob = SkTextBlob::MakeFromRSXform(
         glyphs.data(), glyphs.size() * bytesPerGlyph, rsxforms.data(), *font,
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <jsi/jsi.h>
+
+#include "JsiSkHostObjects.h"
+#include "JsiSkRect.h"
+#include "JsiTypedArray.h"
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkVertices.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+namespace jsi = facebook::jsi;
+
+/**
+ Typed arrays holding the data of a vertex buffer, and the vertices taken from
+ them by the last commit. The typed arrays are only accessed on the
+ Javascript thread, while the committed vertices can be read from any thread.
+ */
+struct VertexArrays {
+  SkVertices::VertexMode mode;
+  int vertexCount;
+  int indexCount;
+
+  std::unique_ptr<jsi::Object> positions;
+  std::unique_ptr<jsi::Object> textures;
+  std::unique_ptr<jsi::Object> colors;
+  std::unique_ptr<jsi::Object> indices;
+
+  /**
+   Returns the vertices of the last commit
+   */
+  sk_sp<SkVertices> getCommitted() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _committed;
+  }
+
+  /**
+   Returns a number that changes with each commit
+   */
+  size_t getVersion() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _version;
+  }
+
+  /**
+   Sets the committed vertices and requests a redraw of the views drawing
+   them.
+   */
+  void commit(sk_sp<SkVertices> vertices) {
+    std::vector<std::function<void()>> redraws;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _committed = std::move(vertices);
+      _version++;
+      for (auto &listener : _listeners) {
+        redraws.push_back(listener.second);
+      }
+    }
+    for (auto &redraw : redraws) {
+      redraw();
+    }
+  }
+
+  /**
+   Calls requestRedraw after each commit, until removed with the same owner
+   */
+  void addListener(const void *owner, std::function<void()> requestRedraw) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _listeners[owner] = std::move(requestRedraw);
+  }
+
+  void removeListener(const void *owner) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _listeners.erase(owner);
+  }
+
+private:
+  std::mutex _mutex;
+  sk_sp<SkVertices> _committed;
+  size_t _version = 0;
+  std::unordered_map<const void *, std::function<void()>> _listeners;
+};
+
+/**
+ Mutable vertex data that JS updates in place through typed arrays, and that
+ is drawn without converting the vertices one by one. Drawing the buffer on a
+ canvas copies the current contents of the arrays. The Vertices node draws
+ what was last committed, since it renders on another thread: commit() copies
+ the arrays and requests a redraw.
+ */
+class JsiSkVertexBuffer
+    : public JsiSkWrappingSharedPtrHostObject<VertexArrays> {
+public:
+  JsiSkVertexBuffer(std::shared_ptr<RNSkPlatformContext> context,
+                    std::shared_ptr<VertexArrays> arrays)
+      : JsiSkWrappingSharedPtrHostObject<VertexArrays>(std::move(context),
+                                                       std::move(arrays)) {}
+
+  JSI_API_TYPENAME(VertexBuffer)
+
+  JSI_PROPERTY_GET(positions) {
+    return jsi::Value(runtime, *getObject()->positions);
+  }
+
+  JSI_PROPERTY_GET(textures) {
+    auto &textures = getObject()->textures;
+    return textures ? jsi::Value(runtime, *textures) : jsi::Value::null();
+  }
+
+  JSI_PROPERTY_GET(colors) {
+    auto &colors = getObject()->colors;
+    return colors ? jsi::Value(runtime, *colors) : jsi::Value::null();
+  }
+
+  JSI_PROPERTY_GET(indices) {
+    auto &indices = getObject()->indices;
+    return indices ? jsi::Value(runtime, *indices) : jsi::Value::null();
+  }
+
+  JSI_PROPERTY_GET(mode) {
+    return static_cast<double>(getObject()->mode);
+  }
+
+  JSI_HOST_FUNCTION(bounds) {
+    auto arrays = getObject();
+    FloatArray positions(runtime, jsi::Value(runtime, *arrays->positions));
+    SkRect bounds;
+    bounds.setBounds(reinterpret_cast<const SkPoint *>(positions.data()),
+                     arrays->vertexCount);
+    return jsi::Object::createFromHostObject(
+        runtime, std::make_shared<JsiSkRect>(getContext(), bounds));
+  }
+
+  JSI_HOST_FUNCTION(commit) {
+    getObject()->commit(makeVertices(runtime));
+    return jsi::Value::undefined();
+  }
+
+  JSI_EXPORT_PROPERTY_GETTERS(JSI_EXPORT_PROP_GET(JsiSkVertexBuffer,
+                                                  __typename__),
+                              JSI_EXPORT_PROP_GET(JsiSkVertexBuffer, positions),
+                              JSI_EXPORT_PROP_GET(JsiSkVertexBuffer, textures),
+                              JSI_EXPORT_PROP_GET(JsiSkVertexBuffer, colors),
+                              JSI_EXPORT_PROP_GET(JsiSkVertexBuffer, indices),
+                              JSI_EXPORT_PROP_GET(JsiSkVertexBuffer, mode))
+
+  JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(JsiSkVertexBuffer, bounds),
+                       JSI_EXPORT_FUNC(JsiSkVertexBuffer, commit),
+                       JSI_EXPORT_FUNC(JsiSkVertexBuffer, dispose))
+
+  /**
+   Copies the current contents of the arrays into vertices that can be drawn.
+   The arrays are resolved again on each call, so this must be called on the
+   Javascript thread. Throws if an index refers to a vertex outside of the
+   buffer.
+   */
+  sk_sp<SkVertices> makeVertices(jsi::Runtime &runtime) {
+    auto arrays = getObject();
+    auto textures = arrays->textures != nullptr
+                        ? jsi::Value(runtime, *arrays->textures)
+                        : jsi::Value::null();
+    auto colors = arrays->colors != nullptr
+                      ? jsi::Value(runtime, *arrays->colors)
+                      : jsi::Value::null();
+    auto indices = arrays->indices != nullptr
+                       ? jsi::Value(runtime, *arrays->indices)
+                       : jsi::Value::null();
+    return MakeVertices(runtime, arrays->mode,
+                        jsi::Value(runtime, *arrays->positions), textures,
+                        colors, indices);
+  }
+
+  /**
+   Copies typed arrays laid out like the arrays of a vertex buffer into
+   vertices that can be drawn: a Float32Array of x, y positions, and the
+   optional Float32Array of x, y texture coordinates, Uint32Array of colors
+   and Uint16Array of indices, which are null or undefined when missing.
+   Vertex buffers and canvas.drawVertexBuffers() both go through here so
+   that they accept the same data.
+   */
+  static sk_sp<SkVertices> MakeVertices(jsi::Runtime &runtime,
+                                        SkVertices::VertexMode mode,
+                                        const jsi::Value &positions,
+                                        const jsi::Value &textures,
+                                        const jsi::Value &colors,
+                                        const jsi::Value &indices) {
+    FloatArray jsiPositions(runtime, positions);
+    auto vertexCount = static_cast<int>(jsiPositions.size() / 2);
+    auto hasTextures = !textures.isNull() && !textures.isUndefined();
+    auto hasColors = !colors.isNull() && !colors.isUndefined();
+    auto hasIndices = !indices.isNull() && !indices.isUndefined();
+
+    // The index count is needed before the copy is allocated
+    std::unique_ptr<RNJsi::JsiTypedArrayView<uint16_t>> jsiIndices;
+    if (hasIndices) {
+      jsiIndices = std::make_unique<RNJsi::JsiTypedArrayView<uint16_t>>(
+          runtime, indices);
+    }
+    auto indexCount =
+        jsiIndices != nullptr ? static_cast<int>(jsiIndices->size()) : 0;
+
+    uint32_t flags = 0;
+    if (hasTextures) {
+      flags |= SkVertices::kHasTexCoords_BuilderFlag;
+    }
+    if (hasColors) {
+      flags |= SkVertices::kHasColors_BuilderFlag;
+    }
+    SkVertices::Builder builder(mode, vertexCount, indexCount, flags);
+    auto pointBytes = sizeof(SkPoint) * vertexCount;
+    memcpy(builder.positions(), jsiPositions.data(), pointBytes);
+    if (hasTextures) {
+      FloatArray jsiTextures(runtime, textures);
+      if (jsiTextures.size() / 2 < static_cast<size_t>(vertexCount)) {
+        throw std::runtime_error(
+            "Expected one texture coordinate for each vertex.");
+      }
+      memcpy(builder.texCoords(), jsiTextures.data(), pointBytes);
+    }
+    if (hasColors) {
+      RNJsi::JsiTypedArrayView<uint32_t> jsiColors(runtime, colors);
+      if (jsiColors.size() < static_cast<size_t>(vertexCount)) {
+        throw std::runtime_error("Expected one color for each vertex.");
+      }
+      memcpy(builder.colors(), jsiColors.data(),
+             sizeof(SkColor) * vertexCount);
+    }
+    if (jsiIndices != nullptr) {
+      // Validated on the copy, which is what gets drawn
+      auto copy = builder.indices();
+      memcpy(copy, jsiIndices->data(), sizeof(uint16_t) * indexCount);
+      for (int i = 0; i < indexCount; i++) {
+        if (copy[i] >= vertexCount) {
+          throw std::runtime_error("Vertex index " + std::to_string(copy[i]) +
+                                   " is out of range for " +
+                                   std::to_string(vertexCount) +
+                                   " vertices.");
+        }
+      }
+    }
+    return builder.detach();
+  }
+
+  /**
+   Returns the vertex buffer for a value, or nullptr if the value is not a
+   vertex buffer.
+   */
+  static std::shared_ptr<JsiSkVertexBuffer> fromValue(jsi::Runtime &runtime,
+                                                      const jsi::Value &value) {
+    if (!value.isObject() || !value.asObject(runtime).isHostObject(runtime)) {
+      return nullptr;
+    }
+    return std::dynamic_pointer_cast<JsiSkVertexBuffer>(
+        value.asObject(runtime).asHostObject(runtime));
+  }
+
+  /**
+   * Creates the function for construction a new vertex buffer
+   * @param context platform context
+   * @return A function for creating a new vertex buffer from the mode, the
+   * vertex count and the optional textures, colors and index count options
+   */
+  static const jsi::HostFunctionType
+  createCtor(std::shared_ptr<RNSkPlatformContext> context) {
+    return JSI_HOST_FUNCTION_LAMBDA {
+      auto arrays = std::shared_ptr<VertexArrays>(
+          new VertexArrays(), [context](VertexArrays *arrays) {
+            // The typed arrays can only be released on the Javascript thread
+            if (context->isOnJavascriptThread()) {
+              delete arrays;
+            } else {
+              context->runOnJavascriptThread([arrays]() { delete arrays; });
+            }
+          });
+      arrays->mode = static_cast<SkVertices::VertexMode>(
+          arguments[0].asNumber());
+      arrays->vertexCount = static_cast<int>(arguments[1].asNumber());
+      arrays->indexCount = 0;
+      auto hasTextures = false;
+      auto hasColors = false;
+      if (count > 2 && arguments[2].isObject()) {
+        auto options = arguments[2].asObject(runtime);
+        auto textures = options.getProperty(runtime, "textures");
+        auto colors = options.getProperty(runtime, "colors");
+        hasTextures = textures.isBool() && textures.getBool();
+        hasColors = colors.isBool() && colors.getBool();
+        auto indexCount = options.getProperty(runtime, "indexCount");
+        if (indexCount.isNumber()) {
+          arrays->indexCount = static_cast<int>(indexCount.asNumber());
+        }
+      }
+      if (arrays->vertexCount < 0 || arrays->indexCount < 0) {
+        throw jsi::JSError(runtime, "Invalid vertex buffer size.");
+      }
+
+      auto size = static_cast<double>(arrays->vertexCount);
+      arrays->positions = makeArray(runtime, "Float32Array", size * 2);
+      if (hasTextures) {
+        arrays->textures = makeArray(runtime, "Float32Array", size * 2);
+      }
+      if (hasColors) {
+        arrays->colors = makeArray(runtime, "Uint32Array", size);
+      }
+      if (arrays->indexCount > 0) {
+        arrays->indices =
+            makeArray(runtime, "Uint16Array", arrays->indexCount);
+      }
+
+      auto buffer =
+          std::make_shared<JsiSkVertexBuffer>(context, std::move(arrays));
+      // Start with the zeroed arrays, so that there is always something to
+      // draw
+      buffer->getObject()->commit(buffer->makeVertices(runtime));
+      return jsi::Object::createFromHostObject(runtime, std::move(buffer));
+    };
+  }
+
+private:
+  using FloatArray = RNJsi::JsiTypedArrayView<float>;
+
+  static std::unique_ptr<jsi::Object>
+  makeArray(jsi::Runtime &runtime, const char *type, double size) {
+    auto array = runtime.global()
+                     .getPropertyAsFunction(runtime, type)
+                     .callAsConstructor(runtime, size);
+    return std::make_unique<jsi::Object>(array.asObject(runtime));
+  }
+};
+
+} // namespace RNSkia
@@ -61,10 +61,8 @@ public:
       auto positionsSize = static_cast<int>(jsiPositions.size(runtime));
       positions.reserve(positionsSize);
       for (int i = 0; i < positionsSize; i++) {
-        std::shared_ptr<SkPoint> point = JsiSkPoint::fromValue(
-            runtime,
-            jsiPositions.getValueAtIndex(runtime, i).asObject(runtime));
-        positions.push_back(*point.get());
+        positions.push_back(JsiSkPoint::getPoint(
+            runtime, jsiPositions.getValueAtIndex(runtime, i)));
       }
 
       if (count >= 3 && !arguments[2].isNull() && !arguments[2].isUndefined()) {
@@ -72,9 +70,8 @@ public:
         auto texsSize = jsiTexs.size(runtime);
         texs.reserve(texsSize);
         for (int i = 0; i < texsSize; i++) {
-          auto point = JsiSkPoint::fromValue(
-              runtime, jsiTexs.getValueAtIndex(runtime, i).asObject(runtime));
-          texs.push_back(*point.get());
+          texs.push_back(JsiSkPoint::getPoint(
+              runtime, jsiTexs.getValueAtIndex(runtime, i)));
         }
       }
 
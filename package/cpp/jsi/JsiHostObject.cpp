@@ -1,5 +1,10 @@
 #include <JsiHostObject.h>
 #include <functional>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <typeinfo>
+#include <utility>
 #include <vector>
 
 // To be able to find objects that aren't cleaned up correctly,
@@ -31,109 +36,242 @@ JsiHostObject::~JsiHostObject() {
 #endif
 }
 
-void JsiHostObject::set(jsi::Runtime &rt, const jsi::PropNameID &name,
-                        const jsi::Value &value) {
+JsiDispatchTable::JsiDispatchTable(const JsiFunctionMap &funcs,
+                                   const JsiPropertyGettersMap &getters,
+                                   const JsiPropertySettersMap &setters) {
+  std::map<std::string, Entry> merged;
+  auto entryFor = [&merged](const std::string &name) -> Entry & {
+    auto it = merged.find(name);
+    if (it == merged.end()) {
+      it = merged.emplace(name, Entry{name, 0, nullptr, nullptr, nullptr})
+               .first;
+    }
+    return it->second;
+  };
 
-  auto nameStr = name.utf8(rt);
+  for (auto &func : funcs) {
+    entryFor(func.first).function = func.second;
+  }
+  for (auto &getter : getters) {
+    entryFor(getter.first).getter = getter.second;
+  }
+  for (auto &setter : setters) {
+    entryFor(setter.first).setter = setter.second;
+  }
 
-  /** Check the static setters map */
-  const JsiPropertySettersMap &setters = getExportedPropertySettersMap();
-  auto setter = setters.find(nameStr);
-  if (setter != setters.end()) {
-    auto dispatcher = std::bind(setter->second, this, std::placeholders::_1,
-                                std::placeholders::_2);
-    return dispatcher(rt, value);
+  _entries.reserve(merged.size());
+  for (auto &entry : merged) {
+    entry.second.index = _entries.size();
+    _entries.push_back(std::move(entry.second));
   }
 
-  if (_propMap.count(nameStr) > 0) {
-    auto prop = _propMap.at(nameStr);
-    (prop.set)(rt, value);
+  if (_entries.empty()) {
+    return;
+  }
+
+  // Search for a seed that gives each name its own slot. We start out with a
+  // sparse table and grow it if we can't find a seed within a few attempts.
+  size_t size = 4;
+  while (size < _entries.size() * 4) {
+    size <<= 1;
+  }
+  while (true) {
+    for (uint32_t seed = 0; seed < 32; ++seed) {
+      if (tryBuild(size, seed)) {
+        return;
+      }
+    }
+    size <<= 1;
   }
 }
 
-jsi::Value JsiHostObject::get(jsi::Runtime &runtime,
-                              const jsi::PropNameID &name) {
-  auto nameStr = name.utf8(runtime);
+bool JsiDispatchTable::tryBuild(size_t size, uint32_t seed) {
+  _slots.assign(size, -1);
+  _mask = static_cast<uint32_t>(size - 1);
+  _seed = seed;
+  for (size_t i = 0; i < _entries.size(); ++i) {
+    auto &slot = _slots[hash(_entries[i].name, seed) & _mask];
+    if (slot >= 0) {
+      return false;
+    }
+    slot = static_cast<int32_t>(i);
+  }
+  return true;
+}
+
+JsiDispatchTable *
+JsiDispatchTable::get(const JsiFunctionMap &funcs,
+                      const JsiPropertyGettersMap &getters,
+                      const JsiPropertySettersMap &setters) {
+  using Key = std::tuple<const void *, const void *, const void *>;
+  static std::mutex lock;
+  static std::map<Key, std::unique_ptr<JsiDispatchTable>> tables;
 
-  // Happy path - cached host functions are cheapest to look up
-  const JsiFunctionMap &funcs = getExportedFunctionMap();
-  auto func = funcs.find(nameStr);
-
-  // Check function cache
-  if (func != funcs.end()) {
-    std::map<std::string, jsi::Function> &runtimeCache =
-        _hostFunctionCache.get(runtime);
-    auto cachedFunc = runtimeCache.find(nameStr);
-    if (cachedFunc != runtimeCache.end()) {
-      return cachedFunc->second.asFunction(runtime);
+  Key key{&funcs, &getters, &setters};
+  std::lock_guard<std::mutex> guard(lock);
+  auto it = tables.find(key);
+  if (it == tables.end()) {
+    it = tables
+             .emplace(key, std::make_unique<JsiDispatchTable>(funcs, getters,
+                                                              setters))
+             .first;
+  }
+  return it->second.get();
+}
+
+JsiDispatchTable::Functions &
+JsiDispatchTable::getFunctions(jsi::Runtime &runtime) {
+  if (&runtime == getMainJsRuntime()) {
+    // Happy path, no lookup or locking for the main runtime
+    auto generation = getMainJsRuntimeGeneration();
+    if (_mainRuntimeGeneration != generation) {
+      // The main runtime was replaced by a reload. The functions of the
+      // previous one can't be released after it is gone, so we leave them.
+      for (auto &func : _mainFunctions) {
+        func.release();
+      }
+      _mainFunctions.clear();
+      _mainFunctions.resize(_entries.size());
+      _mainRuntimeGeneration = generation;
     }
+    return _mainFunctions;
   }
 
-  // Check the static getters map
-  const JsiPropertyGettersMap &getters = getExportedPropertyGettersMap();
-  auto getter = getters.find(nameStr);
-  if (getter != getters.end()) {
-    auto dispatcher = std::bind(getter->second, this, std::placeholders::_1);
-    return dispatcher(runtime);
+  {
+    std::lock_guard<std::mutex> lock(_functionsLock);
+    auto runtimeFunctions = _functions.find(&runtime);
+    if (runtimeFunctions != _functions.end()) {
+      return runtimeFunctions->second;
+    }
   }
 
-  // Check the static function map
-  if (func != funcs.end()) {
+  // The table outlives any runtime, so we need to know when a secondary
+  // runtime goes away to release the functions created in it. This is done
+  // outside of our lock since the monitor calls us back under its own lock.
+  RuntimeLifecycleMonitor::addListener(runtime, this);
+  std::lock_guard<std::mutex> lock(_functionsLock);
+  return _functions.emplace(&runtime, Functions(_entries.size()))
+      .first->second;
+}
 
-    // Create dispatcher
-    auto dispatcher =
-        std::bind(func->second, reinterpret_cast<JsiHostObject *>(this),
-                  std::placeholders::_1, std::placeholders::_2,
-                  std::placeholders::_3, std::placeholders::_4);
+jsi::Value JsiDispatchTable::getFunction(jsi::Runtime &runtime,
+                                         const jsi::PropNameID &name,
+                                         const Entry &entry) {
+  // Each runtime is only used from a single thread, so the functions of a
+  // runtime can be accessed without holding the lock
+  auto &cachedFunc = getFunctions(runtime)[entry.index];
+  if (cachedFunc == nullptr) {
+    // Create dispatcher - the function is shared by all instances so we
+    // resolve the native object from the this value of the call, and make
+    // sure that it is an instance of the class that owns the function.
+    auto func = entry.function;
+    auto dispatcher = [table = this, func](jsi::Runtime &runtime,
+                                           const jsi::Value &thisValue,
+                                           const jsi::Value *arguments,
+                                           size_t count) {
+      if (thisValue.isObject()) {
+        auto self = thisValue.asObject(runtime);
+        if (self.isHostObject(runtime)) {
+          // Keeps the instance alive for the duration of the call
+          auto hostObject = self.getHostObject(runtime);
+          auto instance = table->getInstance(hostObject.get());
+          if (instance != nullptr) {
+            return (instance->*func)(runtime, thisValue, arguments, count);
+          }
+        }
+      }
+      throw jsi::JSError(
+          runtime, "Host function called with a this value that is not an "
+                   "instance of its class. Call it on the object, for "
+                   "instance path.lineTo(x, y), or bind it to the object.");
+    };
 
     // Add to cache - it is important to cache the results from the
     // createFromHostFunction function which takes some time.
-    return _hostFunctionCache.get(runtime)
-        .emplace(nameStr, jsi::Function::createFromHostFunction(runtime, name,
-                                                                0, dispatcher))
-        .first->second.asFunction(runtime);
+    cachedFunc = std::make_unique<jsi::Function>(
+        jsi::Function::createFromHostFunction(runtime, name, 0, dispatcher));
   }
+  return cachedFunc->asFunction(runtime);
+}
 
-  if (_funcMap.count(nameStr) > 0) {
-    return jsi::Function::createFromHostFunction(runtime, name, 0,
-                                                 _funcMap.at(nameStr));
+JsiHostObject *JsiDispatchTable::getInstance(jsi::HostObject *hostObject) {
+  // Happy path - the dynamic type was already seen with this table, so we
+  // compare the type info instead of walking the class hierarchy
+  const auto &type = typeid(*hostObject);
+  if (&type == _instanceType.load(std::memory_order_relaxed)) {
+    return static_cast<JsiHostObject *>(hostObject);
   }
-
-  if (_propMap.count(nameStr) > 0) {
-    auto prop = _propMap.at(nameStr);
-    return (prop.get)(runtime);
+  auto instance = dynamic_cast<JsiHostObject *>(hostObject);
+  if (instance == nullptr || instance->getDispatchTable() != this) {
+    return nullptr;
   }
+  _instanceType.store(&type, std::memory_order_relaxed);
+  return instance;
+}
 
-  return jsi::Value::undefined();
+void JsiDispatchTable::onRuntimeDestroyed(jsi::Runtime *runtime) {
+  std::lock_guard<std::mutex> lock(_functionsLock);
+  _functions.erase(runtime);
 }
 
-std::vector<jsi::PropNameID>
-JsiHostObject::getPropertyNames(jsi::Runtime &runtime) {
-  // statically exported functions
-  const auto &funcs = getExportedFunctionMap();
+void JsiHostObject::set(jsi::Runtime &rt, const jsi::PropNameID &name,
+                        const jsi::Value &value) {
 
-  // Statically exported property getters
-  const auto &getters = getExportedPropertyGettersMap();
+  auto nameStr = name.utf8(rt);
 
-  // Statically exported property setters
-  const auto &setters = getExportedPropertySettersMap();
+  /** Check the static setters map */
+  auto entry = getDispatchTable()->find(nameStr);
+  if (entry != nullptr && entry->setter != nullptr) {
+    return (this->*entry->setter)(rt, value);
+  }
 
-  std::vector<jsi::PropNameID> propNames;
-  propNames.reserve(funcs.size() + getters.size() + setters.size() +
-                    _funcMap.size() + _propMap.size());
+  auto prop = _propMap.find(nameStr);
+  if (prop != _propMap.end()) {
+    (prop->second.set)(rt, value);
+  }
+}
 
-  for (auto it = funcs.cbegin(); it != funcs.cend(); ++it) {
-    propNames.push_back(jsi::PropNameID::forAscii(runtime, it->first));
+jsi::Value JsiHostObject::get(jsi::Runtime &runtime,
+                              const jsi::PropNameID &name) {
+  auto nameStr = name.utf8(runtime);
+
+  // Happy path - statically exported members are resolved with a single
+  // lookup in the dispatch table for this class
+  auto entry = getDispatchTable()->find(nameStr);
+  if (entry != nullptr) {
+    if (entry->getter != nullptr) {
+      return (this->*entry->getter)(runtime);
+    }
+
+    if (entry->function != nullptr) {
+      return getDispatchTable()->getFunction(runtime, name, *entry);
+    }
   }
 
-  for (auto it = getters.cbegin(); it != getters.cend(); ++it) {
-    propNames.push_back(jsi::PropNameID::forUtf8(runtime, it->first));
+  auto func = _funcMap.find(nameStr);
+  if (func != _funcMap.end()) {
+    return jsi::Function::createFromHostFunction(runtime, name, 0,
+                                                 func->second);
   }
 
-  for (auto it = getters.cbegin(); it != getters.cend(); ++it) {
-    if (getters.count(it->first) == 0) {
-      propNames.push_back(jsi::PropNameID::forUtf8(runtime, it->first));
-    }
+  auto prop = _propMap.find(nameStr);
+  if (prop != _propMap.end()) {
+    return (prop->second.get)(runtime);
+  }
+
+  return jsi::Value::undefined();
+}
+
+std::vector<jsi::PropNameID>
+JsiHostObject::getPropertyNames(jsi::Runtime &runtime) {
+  // statically exported functions and properties
+  const auto &entries = getDispatchTable()->getEntries();
+
+  std::vector<jsi::PropNameID> propNames;
+  propNames.reserve(entries.size() + _funcMap.size() + _propMap.size());
+
+  for (auto &entry : entries) {
+    propNames.push_back(jsi::PropNameID::forUtf8(runtime, entry.name));
   }
 
   // functions
@@ -2,14 +2,18 @@
 
 #include <jsi/jsi.h>
 
+#include <atomic>
 #include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <typeinfo>
 #include <unordered_map>
 #include <vector>
 
 #include "RuntimeAwareCache.h"
+#include "RuntimeLifecycleMonitor.h"
 
 #define STR_CAT_NX(A, B) A##B
 #define STR_CAT(A, B) STR_CAT_NX(A, B)
@@ -126,6 +130,117 @@ using JsiPropertySettersMap =
     std::unordered_map<std::string, void (JsiHostObject::*)(
                                         jsi::Runtime &, const jsi::Value &)>;
 
+/**
+ * Lookup table for the statically exported functions, property getters and
+ * property setters of a host object class. The three export maps are merged
+ * into a single perfect hash table the first time an instance of the class is
+ * accessed, so that resolving a property name costs one hash and one string
+ * compare instead of a lookup in each of the maps.
+ *
+ * The table also owns the jsi::Function objects for the exported functions.
+ * These are created once per runtime and shared by all instances of the
+ * class, acting like the methods of a prototype: the functions resolve the
+ * native instance from the `this` value they are called with, and throw if it
+ * is not an instance of the class. Detached calls like `const { lineTo } =
+ * path; lineTo(0, 0)` throw as well. Like RuntimeAwareCache, functions of the
+ * main runtime are kept without locking or lifecycle tracking, only those of
+ * secondary runtimes are.
+ */
+class JsiDispatchTable : public RuntimeLifecycleListener,
+                         public BaseRuntimeAwareCache {
+public:
+  struct Entry {
+    std::string name;
+    size_t index;
+    jsi::Value (JsiHostObject::*function)(jsi::Runtime &, const jsi::Value &,
+                                          const jsi::Value *, size_t);
+    jsi::Value (JsiHostObject::*getter)(jsi::Runtime &);
+    void (JsiHostObject::*setter)(jsi::Runtime &, const jsi::Value &);
+  };
+
+  JsiDispatchTable(const JsiFunctionMap &funcs,
+                   const JsiPropertyGettersMap &getters,
+                   const JsiPropertySettersMap &setters);
+
+  /**
+   Returns the shared table for the given set of export maps. Tables are
+   created once and live for the lifetime of the process.
+   */
+  static JsiDispatchTable *get(const JsiFunctionMap &funcs,
+                               const JsiPropertyGettersMap &getters,
+                               const JsiPropertySettersMap &setters);
+
+  /**
+   Returns the entry with the given name or nullptr if not found
+   */
+  const Entry *find(const std::string &name) const {
+    if (_entries.empty()) {
+      return nullptr;
+    }
+    auto slot = _slots[hash(name, _seed) & _mask];
+    if (slot < 0) {
+      return nullptr;
+    }
+    const auto &entry = _entries[slot];
+    return entry.name == name ? &entry : nullptr;
+  }
+
+  /**
+   Returns all entries in the table
+   */
+  const std::vector<Entry> &getEntries() const { return _entries; }
+
+  /**
+   Returns the shared host function for an exported function entry in the
+   given runtime, creating it on first access.
+   */
+  jsi::Value getFunction(jsi::Runtime &runtime, const jsi::PropNameID &name,
+                         const Entry &entry);
+
+  /**
+   Returns the host object as an instance of the class of this table, or
+   nullptr if it is an instance of another class.
+   */
+  JsiHostObject *getInstance(jsi::HostObject *hostObject);
+
+  /**
+   Releases the functions created in a runtime that is being torn down.
+   */
+  void onRuntimeDestroyed(jsi::Runtime *runtime) override;
+
+private:
+  static uint32_t hash(const std::string &name, uint32_t seed) {
+    // FNV-1a
+    uint32_t h = 2166136261u ^ seed;
+    for (auto c : name) {
+      h ^= static_cast<uint8_t>(c);
+      h *= 16777619u;
+    }
+    return h;
+  }
+
+  bool tryBuild(size_t size, uint32_t seed);
+
+  std::vector<Entry> _entries;
+  std::vector<int32_t> _slots;
+  uint32_t _seed = 0;
+  uint32_t _mask = 0;
+
+  using Functions = std::vector<std::unique_ptr<jsi::Function>>;
+
+  Functions &getFunctions(jsi::Runtime &runtime);
+
+  // Only accessed from the thread of the main runtime
+  Functions _mainFunctions;
+  size_t _mainRuntimeGeneration = 0;
+
+  std::mutex _functionsLock;
+  std::unordered_map<jsi::Runtime *, Functions> _functions;
+
+  // Last dynamic type verified to be an instance of the class of this table
+  std::atomic<const std::type_info *> _instanceType = {nullptr};
+};
+
 /**
  * Base class for jsi host objects
  */
@@ -362,9 +477,26 @@ protected:
   }
 
 private:
+  friend class JsiDispatchTable;
+
+  /**
+   Returns the dispatch table for the statically exported members of this
+   object's class.
+   */
+  JsiDispatchTable *getDispatchTable() {
+    auto table = _dispatchTable.load(std::memory_order_acquire);
+    if (table == nullptr) {
+      table = JsiDispatchTable::get(getExportedFunctionMap(),
+                                    getExportedPropertyGettersMap(),
+                                    getExportedPropertySettersMap());
+      _dispatchTable.store(table, std::memory_order_release);
+    }
+    return table;
+  }
+
   std::unordered_map<std::string, jsi::HostFunctionType> _funcMap;
   std::unordered_map<std::string, JsPropertyType> _propMap;
 
-  RuntimeAwareCache<std::map<std::string, jsi::Function>> _hostFunctionCache;
+  std::atomic<JsiDispatchTable *> _dispatchTable = {nullptr};
 };
 } // namespace RNJsi
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace RNJsi {
+
+namespace jsi = facebook::jsi;
+
+/**
+ Name of the typed array constructor holding elements of type T
+ */
+template <typename T> struct JsiTypedArrayName;
+template <> struct JsiTypedArrayName<float> {
+  static constexpr const char *value = "Float32Array";
+};
+template <> struct JsiTypedArrayName<uint16_t> {
+  static constexpr const char *value = "Uint16Array";
+};
+template <> struct JsiTypedArrayName<uint32_t> {
+  static constexpr const char *value = "Uint32Array";
+};
+
+/**
+ View over the memory of a JS typed array (or a plain ArrayBuffer). The view
+ points straight into the ArrayBuffer backing store and respects the
+ byteOffset and byteLength of the typed array, so no values are copied or
+ converted through JSI, and values written through it are seen by JS. The
+ view is only valid while the underlying JS object is alive and not resized,
+ which is the case for the duration of a host function call that received it
+ as an argument.
+
+ Typed arrays must hold elements of type T (a Float32Array for float), since
+ the values are not converted. ArrayBuffers are read as raw memory.
+ */
+template <typename T> class JsiTypedArrayView {
+public:
+  JsiTypedArrayView(jsi::Runtime &runtime, const jsi::Value &value) {
+    if (!value.isObject()) {
+      throw jsi::JSError(runtime, "Expected a typed array or an ArrayBuffer.");
+    }
+    auto object = value.asObject(runtime);
+    size_t byteOffset = 0;
+    size_t byteLength = 0;
+    uint8_t *base = nullptr;
+    if (object.isArrayBuffer(runtime)) {
+      auto buffer = object.getArrayBuffer(runtime);
+      base = buffer.data(runtime);
+      byteLength = buffer.size(runtime);
+    } else {
+      auto bufferValue = object.getProperty(runtime, "buffer");
+      if (!bufferValue.isObject() ||
+          !bufferValue.asObject(runtime).isArrayBuffer(runtime)) {
+        throw jsi::JSError(runtime,
+                           "Expected a typed array or an ArrayBuffer.");
+      }
+      if (!isInstance(runtime, object)) {
+        throw jsi::JSError(runtime, std::string("Expected a ") +
+                                        JsiTypedArrayName<T>::value + ".");
+      }
+      auto buffer = bufferValue.asObject(runtime).getArrayBuffer(runtime);
+      base = buffer.data(runtime);
+      byteOffset = static_cast<size_t>(
+          object.getProperty(runtime, "byteOffset").asNumber());
+      byteLength = static_cast<size_t>(
+          object.getProperty(runtime, "byteLength").asNumber());
+    }
+    if (byteOffset % alignof(T) != 0) {
+      throw jsi::JSError(runtime, "Typed array is not aligned to " +
+                                      std::to_string(alignof(T)) + " bytes.");
+    }
+    _data = reinterpret_cast<T *>(base + byteOffset);
+    _size = byteLength / sizeof(T);
+  }
+
+  /**
+   Returns true when the value can be read as a typed array view, arrays and
+   host objects are not.
+   */
+  static bool isTypedArray(jsi::Runtime &runtime, const jsi::Value &value) {
+    if (!value.isObject()) {
+      return false;
+    }
+    auto object = value.asObject(runtime);
+    if (object.isArrayBuffer(runtime)) {
+      return true;
+    }
+    if (object.isArray(runtime) || object.isHostObject(runtime)) {
+      return false;
+    }
+    auto buffer = object.getProperty(runtime, "buffer");
+    return buffer.isObject() && buffer.asObject(runtime).isArrayBuffer(runtime);
+  }
+
+  /**
+   Returns true when the object is a typed array with elements of type T.
+   Objects without BYTES_PER_ELEMENT, like plain objects, are rejected with a
+   single property lookup.
+   */
+  static bool isInstance(jsi::Runtime &runtime, const jsi::Object &object) {
+    auto bytesPerElement = object.getProperty(runtime, "BYTES_PER_ELEMENT");
+    if (!bytesPerElement.isNumber() ||
+        bytesPerElement.asNumber() != static_cast<double>(sizeof(T))) {
+      return false;
+    }
+    // Int32Array and Float32Array have the same element size
+    auto constructor = object.getProperty(runtime, "constructor");
+    if (!constructor.isObject()) {
+      return false;
+    }
+    auto name = constructor.asObject(runtime).getProperty(runtime, "name");
+    return name.isString() &&
+           name.asString(runtime).utf8(runtime) == JsiTypedArrayName<T>::value;
+  }
+
+  const T *data() const { return _data; }
+  T *data() { return _data; }
+  size_t size() const { return _size; }
+  const T &operator[](size_t index) const { return _data[index]; }
+
+private:
+  T *_data = nullptr;
+  size_t _size = 0;
+};
+
+} // namespace RNJsi
@@ -1,5 +1,9 @@
 #include "JsiValue.h"
 
+#include <cstring>
+
+#include "JsiTypedArray.h"
+
 namespace RNJsi {
 
 JsiValue::JsiValue() : _type(PropType::Undefined) {}
@@ -15,6 +19,7 @@ void JsiValue::setCurrent(jsi::Runtime &runtime, const jsi::Value &value) {
   _hostFunction = nullptr;
   _props.clear();
   _array.clear();
+  _float32Array.clear();
   _keysCache.clear();
 
   if (value.isNumber()) {
@@ -81,6 +86,14 @@ const JsiValue &JsiValue::getValue(PropId name) const {
   return _props.at(name);
 }
 
+const std::vector<float> &JsiValue::getAsFloat32Array() const {
+  if (_type != PropType::Float32Array) {
+    throw std::runtime_error("Expected type Float32Array, got " +
+                             getTypeAsString(_type));
+  }
+  return _float32Array;
+}
+
 bool JsiValue::hasValue(PropId name) const {
   if (_type != PropType::Object) {
     throw std::runtime_error("Expected type object, got " +
@@ -137,6 +150,8 @@ std::string JsiValue::asString() const {
     return "[HostObject]";
   case PropType::HostFunction:
     return "[HostFunction]";
+  case PropType::Float32Array:
+    return "[Float32Array]";
   }
 }
 
@@ -160,6 +175,8 @@ jsi::Value JsiValue::getAsJsiValue(jsi::Runtime &runtime) const {
     return getHostObject(runtime);
   case PropType::HostFunction:
     return getHostFunction(runtime);
+  case PropType::Float32Array:
+    return getFloat32Array(runtime);
   }
 }
 
@@ -183,6 +200,8 @@ std::string JsiValue::getTypeAsString(PropType type) {
     return "hostobject";
   case PropType::HostFunction:
     return "hostfunction";
+  case PropType::Float32Array:
+    return "Float32Array";
   }
 }
 
@@ -194,6 +213,8 @@ void JsiValue::setObject(jsi::Runtime &runtime, const jsi::Value &value) {
     setArray(runtime, obj);
   } else if (obj.isHostObject(runtime)) {
     setHostObject(runtime, obj);
+  } else if (isFloat32Array(runtime, obj)) {
+    setFloat32Array(runtime, value);
   } else {
     _type = PropType::Object;
     // Read object keys
@@ -278,6 +299,8 @@ bool JsiValue::operator==(const JsiValue &other) const {
   case PropType::HostFunction:
     // Unable to compare host functions
     return false;
+  case PropType::Float32Array:
+    return _float32Array == other.getAsFloat32Array();
   }
 
   throw std::runtime_error(
@@ -343,4 +366,29 @@ jsi::Object JsiValue::getHostObject(jsi::Runtime &runtime) const {
   return jsi::Object::createFromHostObject(runtime, _hostObject);
 }
 
+bool JsiValue::isFloat32Array(jsi::Runtime &runtime, const jsi::Object &obj) {
+  // Plain objects are rejected after a single property lookup
+  return JsiTypedArrayView<float>::isInstance(runtime, obj);
+}
+
+void JsiValue::setFloat32Array(jsi::Runtime &runtime,
+                               const jsi::Value &value) {
+  _type = PropType::Float32Array;
+  JsiTypedArrayView<float> view(runtime, value);
+  _float32Array.assign(view.data(), view.data() + view.size());
+}
+
+jsi::Object JsiValue::getFloat32Array(jsi::Runtime &runtime) const {
+  assert(_type == PropType::Float32Array);
+  auto array = runtime.global()
+                   .getPropertyAsFunction(runtime, "Float32Array")
+                   .callAsConstructor(runtime,
+                                      static_cast<double>(_float32Array.size()))
+                   .asObject(runtime);
+  JsiTypedArrayView<float> view(runtime, jsi::Value(runtime, array));
+  memcpy(view.data(), _float32Array.data(),
+         sizeof(float) * _float32Array.size());
+  return array;
+}
+
 } // namespace RNJsi
@@ -21,7 +21,8 @@ enum struct PropType {
   Object = 5,
   HostObject = 6,
   HostFunction = 7,
-  Array = 8
+  Array = 8,
+  Float32Array = 9
 };
 
 using PropId = const char *;
@@ -112,6 +113,12 @@ public:
    */
   const std::vector<JsiValue> &getAsArray() const;
 
+  /**
+   Returns the values of a Float32Array, copied in one go instead of one
+   property at a time. Requires that the underlying type is Float32Array
+   */
+  const std::vector<float> &getAsFloat32Array() const;
+
   /**
    Returns an inner value by name. Requires that the underlying type is Object
    */
@@ -208,6 +215,10 @@ private:
   void setHostObject(jsi::Runtime &runtime, const jsi::Object &obj);
   jsi::Object getHostObject(jsi::Runtime &runtime) const;
 
+  bool isFloat32Array(jsi::Runtime &runtime, const jsi::Object &obj);
+  void setFloat32Array(jsi::Runtime &runtime, const jsi::Value &value);
+  jsi::Object getFloat32Array(jsi::Runtime &runtime) const;
+
   PropType _type = PropType::Undefined;
   bool _boolValue;
   double _numberValue;
@@ -215,6 +226,7 @@ private:
   std::shared_ptr<jsi::HostObject> _hostObject;
   jsi::HostFunctionType _hostFunction;
   std::vector<JsiValue> _array;
+  std::vector<float> _float32Array;
   std::unordered_map<PropId, JsiValue> _props;
   std::vector<PropId> _keysCache;
 };
@@ -3,5 +3,6 @@
 namespace RNJsi {
 
 jsi::Runtime *BaseRuntimeAwareCache::_mainRuntime = nullptr;
+size_t BaseRuntimeAwareCache::_mainRuntimeGeneration = 0;
 
 } // namespace RNJsi
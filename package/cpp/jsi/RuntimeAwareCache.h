@@ -14,7 +14,10 @@ namespace jsi = facebook::jsi;
 
 class BaseRuntimeAwareCache {
 public:
-  static void setMainJsRuntime(jsi::Runtime *rt) { _mainRuntime = rt; }
+  static void setMainJsRuntime(jsi::Runtime *rt) {
+    _mainRuntime = rt;
+    _mainRuntimeGeneration++;
+  }
 
 protected:
   static jsi::Runtime *getMainJsRuntime() {
@@ -25,8 +28,16 @@ protected:
     return _mainRuntime;
   }
 
+  /**
+   * Incremented each time the main runtime is set, so that caches living
+   * longer than a runtime can tell that it was replaced (on reloads), even if
+   * the new runtime has the same address.
+   */
+  static size_t getMainJsRuntimeGeneration() { return _mainRuntimeGeneration; }
+
 private:
   static jsi::Runtime *_mainRuntime;
+  static size_t _mainRuntimeGeneration;
 };
 
 /**
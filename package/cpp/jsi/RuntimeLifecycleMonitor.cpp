@@ -1,11 +1,14 @@
 #include "RuntimeLifecycleMonitor.h"
 
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
 namespace RNJsi {
 
+// Listeners are added from the threads of the different runtimes
+static std::mutex listenersLock;
 static std::unordered_map<jsi::Runtime *,
                           std::unordered_set<RuntimeLifecycleListener *>>
     listeners;
@@ -14,18 +17,26 @@ struct RuntimeLifecycleMonitorObject : public jsi::HostObject {
   jsi::Runtime *_rt;
   explicit RuntimeLifecycleMonitorObject(jsi::Runtime *rt) : _rt(rt) {}
   ~RuntimeLifecycleMonitorObject() {
-    auto listenersSet = listeners.find(_rt);
-    if (listenersSet != listeners.end()) {
-      for (auto listener : listenersSet->second) {
-        listener->onRuntimeDestroyed(_rt);
+    std::unordered_set<RuntimeLifecycleListener *> runtimeListeners;
+    {
+      std::lock_guard<std::mutex> lock(listenersLock);
+      auto listenersSet = listeners.find(_rt);
+      if (listenersSet == listeners.end()) {
+        return;
       }
+      runtimeListeners = std::move(listenersSet->second);
       listeners.erase(listenersSet);
     }
+    // Called without the lock, listeners take their own locks
+    for (auto listener : runtimeListeners) {
+      listener->onRuntimeDestroyed(_rt);
+    }
   }
 };
 
 void RuntimeLifecycleMonitor::addListener(jsi::Runtime &rt,
                                           RuntimeLifecycleListener *listener) {
+  std::lock_guard<std::mutex> lock(listenersLock);
   auto listenersSet = listeners.find(&rt);
   if (listenersSet == listeners.end()) {
     // We install a global host object in the provided runtime, this way we can
@@ -46,6 +57,7 @@ void RuntimeLifecycleMonitor::addListener(jsi::Runtime &rt,
 
 void RuntimeLifecycleMonitor::removeListener(
     jsi::Runtime &rt, RuntimeLifecycleListener *listener) {
+  std::lock_guard<std::mutex> lock(listenersLock);
   auto listenersSet = listeners.find(&rt);
   if (listenersSet == listeners.end()) {
     // nothing to do here
@@ -0,0 +1,411 @@
+#pragma once
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkBBHFactory.h"
+#include "SkCanvas.h"
+#include "SkNWayCanvas.h"
+#include "SkPaint.h"
+#include "SkPath.h"
+#include "SkPicture.h"
+#include "SkPictureRecorder.h"
+#include "SkRRect.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+/**
+ Canvas that forwards everything to a target canvas while merging runs of
+ rects, rounded rects and ovals drawn with the same paint into a single path
+ draw. This is used between recording and playback of pictures where many
+ small shapes with identical paints (like the cells of a chart) would
+ otherwise each become a separate draw with its own save / restore.
+
+ Shapes are only merged when the paint is opaque and has no effects, when
+ they are drawn with the same clip and matrices that only differ by a
+ translation, and, for antialiased paints, when they are at least a pixel
+ apart. Antialiased edges that overlap or touch are blended once per draw but
+ only once for a path, so merging them would change the pixels. Any other
+ call flushes the pending shapes first so that the drawing order is kept.
+ */
+class RNSkBatchingCanvas : public SkNWayCanvas {
+public:
+  RNSkBatchingCanvas(SkCanvas *target, int width, int height)
+      : SkNWayCanvas(width, height), _target(target) {
+    addCanvas(target);
+  }
+
+  /**
+   Plays a picture back through a batching canvas into a new picture recorded
+   with an R-tree. The picture must have been recorded without a bounding box
+   hierarchy, otherwise the playback would cull its draws against the clip of
+   the batching canvas, which starts at the origin.
+   */
+  static sk_sp<SkPicture> makeBatchedPicture(const sk_sp<SkPicture> &picture) {
+    auto bounds = picture->cullRect();
+    SkRTreeFactory factory;
+    SkPictureRecorder recorder;
+    auto canvas = recorder.beginRecording(bounds, &factory);
+    RNSkBatchingCanvas batchingCanvas(canvas,
+                                      SkScalarCeilToInt(bounds.width()),
+                                      SkScalarCeilToInt(bounds.height()));
+    picture->playback(&batchingCanvas);
+    batchingCanvas.flushBatch();
+    return recorder.finishRecordingAsPicture();
+  }
+
+  /**
+   Draws the pending shapes to the target canvas. Must be called before the
+   target is used directly, ie. before finishing a recording.
+   */
+  void flushBatch() {
+    if (_batch.empty()) {
+      return;
+    }
+
+    // The shapes are stored in the coordinates of the matrix that was used
+    // when the batch was started, so we need to go back to it for drawing.
+    auto matrix = getTotalMatrix();
+    auto restore = false;
+    if (matrix != _batchMatrix) {
+      SkMatrix inverse;
+      if (matrix.invert(&inverse)) {
+        _target->save();
+        _target->concat(SkMatrix::Concat(inverse, _batchMatrix));
+        restore = true;
+      }
+    }
+
+    if (_batch.size() == 1) {
+      _target->drawRRect(_batch[0], _batchPaint);
+    } else {
+      SkPath path;
+      for (auto &rrect : _batch) {
+        path.addRRect(rrect, SkPathDirection::kCW);
+      }
+      _target->drawPath(path, _batchPaint);
+    }
+
+    if (restore) {
+      _target->restore();
+    }
+    _batch.clear();
+    _batchBounds.clear();
+  }
+
+protected:
+  void onDrawRect(const SkRect &rect, const SkPaint &paint) override {
+    if (!addToBatch(SkRRect::MakeRect(rect), paint)) {
+      SkNWayCanvas::onDrawRect(rect, paint);
+    }
+  }
+
+  void onDrawRRect(const SkRRect &rrect, const SkPaint &paint) override {
+    if (!addToBatch(rrect, paint)) {
+      SkNWayCanvas::onDrawRRect(rrect, paint);
+    }
+  }
+
+  void onDrawOval(const SkRect &rect, const SkPaint &paint) override {
+    if (!addToBatch(SkRRect::MakeOval(rect), paint)) {
+      SkNWayCanvas::onDrawOval(rect, paint);
+    }
+  }
+
+  // Saving and changing the matrix doesn't affect the batch, restoring the
+  // state the batch was started in does.
+  void willRestore() override {
+    if (!_batch.empty() && getSaveCount() <= _batchSaveCount) {
+      flushBatch();
+    }
+    SkNWayCanvas::willRestore();
+  }
+
+  SaveLayerStrategy getSaveLayerStrategy(const SaveLayerRec &rec) override {
+    flushBatch();
+    return SkNWayCanvas::getSaveLayerStrategy(rec);
+  }
+
+  bool onDoSaveBehind(const SkRect *bounds) override {
+    flushBatch();
+    return SkNWayCanvas::onDoSaveBehind(bounds);
+  }
+
+  void onClipRect(const SkRect &rect, SkClipOp op,
+                  ClipEdgeStyle edgeStyle) override {
+    flushBatch();
+    SkNWayCanvas::onClipRect(rect, op, edgeStyle);
+  }
+
+  void onClipRRect(const SkRRect &rrect, SkClipOp op,
+                   ClipEdgeStyle edgeStyle) override {
+    flushBatch();
+    SkNWayCanvas::onClipRRect(rrect, op, edgeStyle);
+  }
+
+  void onClipPath(const SkPath &path, SkClipOp op,
+                  ClipEdgeStyle edgeStyle) override {
+    flushBatch();
+    SkNWayCanvas::onClipPath(path, op, edgeStyle);
+  }
+
+  void onClipShader(sk_sp<SkShader> shader, SkClipOp op) override {
+    flushBatch();
+    SkNWayCanvas::onClipShader(std::move(shader), op);
+  }
+
+  void onClipRegion(const SkRegion &region, SkClipOp op) override {
+    flushBatch();
+    SkNWayCanvas::onClipRegion(region, op);
+  }
+
+  void onResetClip() override {
+    flushBatch();
+    SkNWayCanvas::onResetClip();
+  }
+
+  void onDrawPaint(const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawPaint(paint);
+  }
+
+  void onDrawBehind(const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawBehind(paint);
+  }
+
+  void onDrawPoints(PointMode mode, size_t count, const SkPoint pts[],
+                    const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawPoints(mode, count, pts, paint);
+  }
+
+  void onDrawRegion(const SkRegion &region, const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawRegion(region, paint);
+  }
+
+  void onDrawArc(const SkRect &rect, SkScalar startAngle, SkScalar sweepAngle,
+                 bool useCenter, const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawArc(rect, startAngle, sweepAngle, useCenter, paint);
+  }
+
+  void onDrawDRRect(const SkRRect &outer, const SkRRect &inner,
+                    const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawDRRect(outer, inner, paint);
+  }
+
+  void onDrawPath(const SkPath &path, const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawPath(path, paint);
+  }
+
+  void onDrawTextBlob(const SkTextBlob *blob, SkScalar x, SkScalar y,
+                      const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawTextBlob(blob, x, y, paint);
+  }
+
+  void onDrawGlyphRunList(const sktext::GlyphRunList &list,
+                          const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawGlyphRunList(list, paint);
+  }
+
+  void onDrawPatch(const SkPoint cubics[12], const SkColor colors[4],
+                   const SkPoint texCoords[4], SkBlendMode mode,
+                   const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawPatch(cubics, colors, texCoords, mode, paint);
+  }
+
+  void onDrawImage2(const SkImage *image, SkScalar x, SkScalar y,
+                    const SkSamplingOptions &sampling,
+                    const SkPaint *paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawImage2(image, x, y, sampling, paint);
+  }
+
+  void onDrawImageRect2(const SkImage *image, const SkRect &src,
+                        const SkRect &dst, const SkSamplingOptions &sampling,
+                        const SkPaint *paint,
+                        SrcRectConstraint constraint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawImageRect2(image, src, dst, sampling, paint,
+                                   constraint);
+  }
+
+  void onDrawImageLattice2(const SkImage *image, const Lattice &lattice,
+                           const SkRect &dst, SkFilterMode filter,
+                           const SkPaint *paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawImageLattice2(image, lattice, dst, filter, paint);
+  }
+
+  void onDrawAtlas2(const SkImage *image, const SkRSXform xforms[],
+                    const SkRect tex[], const SkColor colors[], int count,
+                    SkBlendMode mode, const SkSamplingOptions &sampling,
+                    const SkRect *cull, const SkPaint *paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawAtlas2(image, xforms, tex, colors, count, mode,
+                               sampling, cull, paint);
+  }
+
+  void onDrawVerticesObject(const SkVertices *vertices, SkBlendMode mode,
+                            const SkPaint &paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawVerticesObject(vertices, mode, paint);
+  }
+
+  void onDrawShadowRec(const SkPath &path,
+                       const SkDrawShadowRec &rec) override {
+    flushBatch();
+    SkNWayCanvas::onDrawShadowRec(path, rec);
+  }
+
+  void onDrawPicture(const SkPicture *picture, const SkMatrix *matrix,
+                     const SkPaint *paint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawPicture(picture, matrix, paint);
+  }
+
+  void onDrawDrawable(SkDrawable *drawable, const SkMatrix *matrix) override {
+    flushBatch();
+    SkNWayCanvas::onDrawDrawable(drawable, matrix);
+  }
+
+  void onDrawAnnotation(const SkRect &rect, const char key[],
+                        SkData *value) override {
+    flushBatch();
+    SkNWayCanvas::onDrawAnnotation(rect, key, value);
+  }
+
+  void onDrawEdgeAAQuad(const SkRect &rect, const SkPoint clip[4],
+                        QuadAAFlags aa, const SkColor4f &color,
+                        SkBlendMode mode) override {
+    flushBatch();
+    SkNWayCanvas::onDrawEdgeAAQuad(rect, clip, aa, color, mode);
+  }
+
+  void onDrawEdgeAAImageSet2(const ImageSetEntry set[], int count,
+                             const SkPoint dstClips[],
+                             const SkMatrix preViewMatrices[],
+                             const SkSamplingOptions &sampling,
+                             const SkPaint *paint,
+                             SrcRectConstraint constraint) override {
+    flushBatch();
+    SkNWayCanvas::onDrawEdgeAAImageSet2(set, count, dstClips, preViewMatrices,
+                                        sampling, paint, constraint);
+  }
+
+private:
+  /**
+   Shapes are only merged when overlapping them doesn't change the result.
+   */
+  static bool isBatchable(const SkPaint &paint) {
+    auto blendMode = paint.asBlendMode();
+    return paint.getAlpha() == 0xFF && paint.getShader() == nullptr &&
+           paint.getColorFilter() == nullptr &&
+           paint.getMaskFilter() == nullptr &&
+           paint.getPathEffect() == nullptr &&
+           paint.getImageFilter() == nullptr && blendMode.has_value() &&
+           blendMode.value() == SkBlendMode::kSrcOver;
+  }
+
+  /**
+   Returns true if an antialiased shape with the given device bounds would
+   overlap or touch a shape of the batch.
+   */
+  bool overlapsBatch(const SkRect &deviceBounds) {
+    for (auto &bounds : _batchBounds) {
+      if (SkRect::Intersects(bounds, deviceBounds)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /**
+   Returns true if the matrix only differs from the batch matrix by a
+   translation.
+   */
+  bool isTranslatedBatchMatrix(const SkMatrix &matrix) {
+    return !matrix.hasPerspective() &&
+           matrix.getScaleX() == _batchMatrix.getScaleX() &&
+           matrix.getScaleY() == _batchMatrix.getScaleY() &&
+           matrix.getSkewX() == _batchMatrix.getSkewX() &&
+           matrix.getSkewY() == _batchMatrix.getSkewY();
+  }
+
+  bool addToBatch(const SkRRect &rrect, const SkPaint &paint) {
+    if (!isBatchable(paint)) {
+      flushBatch();
+      return false;
+    }
+
+    auto matrix = getTotalMatrix();
+    SkRect deviceBounds = SkRect::MakeEmpty();
+    if (paint.isAntiAlias()) {
+      // Outset by the stroke, and by a pixel for the antialiased edges
+      SkRect storage;
+      deviceBounds = matrix
+                         .mapRect(paint.canComputeFastBounds()
+                                      ? paint.computeFastBounds(rrect.rect(),
+                                                                &storage)
+                                      : rrect.rect())
+                         .makeOutset(1, 1);
+    }
+    if (!_batch.empty() &&
+        (_batch.size() >= MaxBatchSize || paint != _batchPaint ||
+         !isTranslatedBatchMatrix(matrix) ||
+         (paint.isAntiAlias() && overlapsBatch(deviceBounds)))) {
+      flushBatch();
+    }
+
+    if (_batch.empty()) {
+      if (matrix.hasPerspective() || !matrix.invert(&_batchInverse)) {
+        return false;
+      }
+      _batchMatrix = matrix;
+      _batchPaint = paint;
+      _batchSaveCount = getSaveCount();
+      _batch.push_back(rrect);
+      if (paint.isAntiAlias()) {
+        _batchBounds.push_back(deviceBounds);
+      }
+      return true;
+    }
+
+    // Map the translation between the two matrices back into the coordinates
+    // of the batch matrix.
+    auto offset = _batchInverse.mapVector(
+        matrix.getTranslateX() - _batchMatrix.getTranslateX(),
+        matrix.getTranslateY() - _batchMatrix.getTranslateY());
+    _batch.push_back(rrect.makeOffset(offset.x(), offset.y()));
+    if (paint.isAntiAlias()) {
+      _batchBounds.push_back(deviceBounds);
+    }
+    return true;
+  }
+
+  static constexpr size_t MaxBatchSize = 256;
+
+  SkCanvas *_target;
+  std::vector<SkRRect> _batch;
+  // Device bounds of the shapes of an antialiased batch
+  std::vector<SkRect> _batchBounds;
+  SkPaint _batchPaint;
+  SkMatrix _batchMatrix;
+  SkMatrix _batchInverse;
+  int _batchSaveCount = 0;
+};
+
+} // namespace RNSkia
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkContourMeasure.h"
+#include "SkPath.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+using RNSkContourMeasures = std::vector<sk_sp<SkContourMeasure>>;
+
+/**
+ Cache for the contours measured on a path. Measuring flattens the whole path,
+ while animations along a path (like markers following a route) measure the
+ same path every frame. Contours are kept by the generation id of the path,
+ which changes whenever its points or verbs do, and are immutable so they are
+ shared between all users. Entries are evicted in least recently used order.
+
+ Paths that are only measured once, like the interpolated paths of a morph
+ animation which get a new generation id every frame, would evict all other
+ entries. Contours are therefore only cached once their path is measured a
+ second time.
+ */
+class RNSkContourMeasureCache {
+public:
+  static RNSkContourMeasureCache &getInstance() {
+    static RNSkContourMeasureCache instance;
+    return instance;
+  }
+
+  /**
+   Returns the contours of the path, as returned by SkContourMeasureIter.
+   */
+  std::shared_ptr<const RNSkContourMeasures>
+  getContours(const SkPath &path, bool forceClosed, SkScalar resScale) {
+    Key key = {path.getGenerationID(), forceClosed, resScale};
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto it = _entries.find(key);
+      if (it != _entries.end()) {
+        _lru.splice(_lru.begin(), _lru, it->second.position);
+        return it->second.contours;
+      }
+    }
+
+    auto contours = std::make_shared<RNSkContourMeasures>();
+    SkContourMeasureIter iter(path, forceClosed, resScale);
+    while (auto contour = iter.next()) {
+      contours->push_back(std::move(contour));
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_seen.insert(key).second) {
+      _seenOrder.push_back(key);
+      if (_seenOrder.size() > MaxEntries) {
+        _seen.erase(_seenOrder.front());
+        _seenOrder.pop_front();
+      }
+      return contours;
+    }
+    auto inserted = _entries.emplace(key, Entry{contours, {}});
+    if (!inserted.second) {
+      return inserted.first->second.contours;
+    }
+    _lru.push_front(key);
+    inserted.first->second.position = _lru.begin();
+    while (_entries.size() > MaxEntries) {
+      _entries.erase(_lru.back());
+      _lru.pop_back();
+    }
+    return contours;
+  }
+
+private:
+  struct Key {
+    uint32_t generationId;
+    bool forceClosed;
+    SkScalar resScale;
+
+    bool operator==(const Key &other) const {
+      return generationId == other.generationId &&
+             forceClosed == other.forceClosed && resScale == other.resScale;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const {
+      uint32_t scale;
+      memcpy(&scale, &key.resScale, sizeof(scale));
+      return (std::hash<uint32_t>()(key.generationId) * 31 +
+              std::hash<uint32_t>()(scale)) *
+                 2 +
+             key.forceClosed;
+    }
+  };
+
+  struct Entry {
+    std::shared_ptr<const RNSkContourMeasures> contours;
+    std::list<Key>::iterator position;
+  };
+
+  static constexpr size_t MaxEntries = 256;
+
+  std::unordered_map<Key, Entry, KeyHash> _entries;
+  std::list<Key> _lru;
+  // Keys of the paths measured recently, oldest first
+  std::unordered_set<Key, KeyHash> _seen;
+  std::deque<Key> _seenOrder;
+  std::mutex _mutex;
+};
+
+} // namespace RNSkia
@@ -1,8 +1,12 @@
 #include "RNSkDomView.h"
+#include "DomCapture.h"
 #include "DrawingContext.h"
 
+#include <algorithm>
 #include <chrono>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
@@ -39,9 +43,13 @@ bool RNSkDomRenderer::tryRender(
     bool result = false;
     // If we have a Dom Node we can render directly on the main thread
     if (_root != nullptr) {
-      result = canvasProvider->renderToCanvas(std::bind(
-          &RNSkDomRenderer::renderCanvas, this, std::placeholders::_1,
-          canvasProvider->getScaledWidth(), canvasProvider->getScaledHeight()));
+      // A lambda with small captures fits in the std::function without
+      // allocating, which std::bind doesn't.
+      result = canvasProvider->renderToCanvas(
+          [this, width = canvasProvider->getScaledWidth(),
+           height = canvasProvider->getScaledHeight()](SkCanvas *canvas) {
+            renderCanvas(canvas, width, height);
+          });
     }
 
     _renderLock->unlock();
@@ -55,9 +63,11 @@ void RNSkDomRenderer::renderImmediate(
     std::shared_ptr<RNSkCanvasProvider> canvasProvider) {
   auto prevDebugOverlay = getShowDebugOverlays();
   setShowDebugOverlays(false);
-  canvasProvider->renderToCanvas(std::bind(
-      &RNSkDomRenderer::renderCanvas, this, std::placeholders::_1,
-      canvasProvider->getScaledWidth(), canvasProvider->getScaledHeight()));
+  canvasProvider->renderToCanvas(
+      [this, width = canvasProvider->getScaledWidth(),
+       height = canvasProvider->getScaledHeight()](SkCanvas *canvas) {
+        renderCanvas(canvas, width, height);
+      });
   setShowDebugOverlays(prevDebugOverlay);
 }
 
@@ -75,15 +85,62 @@ void RNSkDomRenderer::setOnTouchCallback(
   _touchCallback = onTouchCallback;
 }
 
-void RNSkDomRenderer::renderCanvas(SkCanvas *canvas, float scaledWidth,
-                                   float scaledHeight) {
-  _renderTimingInfo.beginTiming();
+void RNSkDomRenderer::setOnTouchBufferCallback(
+    std::shared_ptr<jsi::Function> onTouchBufferCallback) {
+  _touchBufferCallback = onTouchBufferCallback;
+}
+
+std::vector<size_t> RNSkDomRenderer::hitTest(const HitTestQuery &query) {
+  std::vector<size_t> result;
+  std::lock_guard<std::mutex> lock(_rootLock);
+  if (_root != nullptr) {
+    _root->hitTest(query, &result);
+  }
+  return result;
+}
+
+RNSkDomCapture RNSkDomRenderer::capture(float scaledWidth,
+                                        float scaledHeight) {
+  RNSkDomCapture result;
+  std::lock_guard<std::timed_mutex> renderLock(*_renderLock);
+  std::lock_guard<std::mutex> lock(_rootLock);
+  if (_root == nullptr) {
+    return result;
+  }
 
+  // The picture is recorded without a bounding box hierarchy so that the
+  // annotations marking each node are kept.
   auto pd = _platformContext->getPixelDensity();
-  canvas->clear(SK_ColorTRANSPARENT);
-  canvas->save();
+  SkPictureRecorder recorder;
+  auto canvas = recorder.beginRecording(
+      SkRect::MakeWH(scaledWidth * pd, scaledHeight * pd));
   canvas->scale(pd, pd);
 
+  ensureDrawingContext();
+  _drawingContext->setScaledWidth(scaledWidth);
+  _drawingContext->setScaledHeight(scaledHeight);
+  _drawingContext->setCanvas(canvas);
+  _drawingContext->setCapturing(true);
+
+  try {
+    _root->commitPendingChanges(_drawingContext.get());
+    _root->render(_drawingContext.get());
+    _root->resetPendingChanges();
+  } catch (...) {
+    _drawingContext->setCapturing(false);
+    throw;
+  }
+  _drawingContext->setCapturing(false);
+
+  result.tree = DomCapture(_drawingContext->getCaptureId()).serialize(_root);
+  result.picture = recorder.finishRecordingAsPicture()->serialize();
+
+  // Changes committed by the capture still need to reach the screen
+  _requestRedraw();
+  return result;
+}
+
+void RNSkDomRenderer::ensureDrawingContext() {
   if (_drawingContext == nullptr) {
     _drawingContext = std::make_shared<DrawingContext>();
 
@@ -94,6 +151,18 @@ void RNSkDomRenderer::renderCanvas(SkCanvas *canvas, float scaledWidth,
       }
     });
   }
+}
+
+void RNSkDomRenderer::renderCanvas(SkCanvas *canvas, float scaledWidth,
+                                   float scaledHeight) {
+  _renderTimingInfo.beginTiming();
+
+  auto pd = _platformContext->getPixelDensity();
+  canvas->clear(SK_ColorTRANSPARENT);
+  canvas->save();
+  canvas->scale(pd, pd);
+
+  ensureDrawingContext();
 
   _drawingContext->setScaledWidth(scaledWidth);
   _drawingContext->setScaledHeight(scaledHeight);
@@ -105,7 +174,7 @@ void RNSkDomRenderer::renderCanvas(SkCanvas *canvas, float scaledWidth,
     // Ask the root node to render to the provided canvas
     std::lock_guard<std::mutex> lock(_rootLock);
     if (_root != nullptr) {
-      _root->commitPendingChanges();
+      _root->commitPendingChanges(_drawingContext.get());
       _root->render(_drawingContext.get());
       _root->resetPendingChanges();
     }
@@ -140,7 +209,7 @@ void RNSkDomRenderer::updateTouches(std::vector<RNSkTouchInfo> &touches) {
 
 void RNSkDomRenderer::callOnTouch() {
 
-  if (_touchCallback == nullptr) {
+  if (_touchCallback == nullptr && _touchBufferCallback == nullptr) {
     return;
   }
 
@@ -162,31 +231,37 @@ void RNSkDomRenderer::callOnTouch() {
       auto self = weakSelf.lock();
       if (self) {
         jsi::Runtime &runtime = *self->_platformContext->getJsRuntime();
-        // Set up touches
-        auto size = self->_touchesCache.size();
-        auto ops = jsi::Array(runtime, size);
-        for (size_t i = 0; i < size; i++) {
-          auto cur = self->_touchesCache.at(i);
-          auto curSize = cur.size();
-          auto touches = jsi::Array(runtime, curSize);
-          for (size_t n = 0; n < curSize; n++) {
-            auto touchObj = jsi::Object(runtime);
-            auto t = cur.at(n);
-            touchObj.setProperty(runtime, "x", t.x);
-            touchObj.setProperty(runtime, "y", t.y);
-            touchObj.setProperty(runtime, "force", t.force);
-            touchObj.setProperty(runtime, "type", static_cast<double>(t.type));
-            touchObj.setProperty(runtime, "timestamp",
-                                 static_cast<double>(t.timestamp) / 1000.0);
-            touchObj.setProperty(runtime, "id", static_cast<double>(t.id));
-            touches.setValueAtIndex(runtime, n, touchObj);
+        if (self->_touchCallback != nullptr) {
+          // Set up touches
+          auto size = self->_touchesCache.size();
+          auto ops = jsi::Array(runtime, size);
+          for (size_t i = 0; i < size; i++) {
+            auto cur = self->_touchesCache.at(i);
+            auto curSize = cur.size();
+            auto touches = jsi::Array(runtime, curSize);
+            for (size_t n = 0; n < curSize; n++) {
+              auto touchObj = jsi::Object(runtime);
+              auto t = cur.at(n);
+              touchObj.setProperty(runtime, "x", t.x);
+              touchObj.setProperty(runtime, "y", t.y);
+              touchObj.setProperty(runtime, "force", t.force);
+              touchObj.setProperty(runtime, "type",
+                                   static_cast<double>(t.type));
+              touchObj.setProperty(runtime, "timestamp",
+                                   static_cast<double>(t.timestamp) / 1000.0);
+              touchObj.setProperty(runtime, "id", static_cast<double>(t.id));
+              touches.setValueAtIndex(runtime, n, touchObj);
+            }
+            ops.setValueAtIndex(runtime, i, touches);
           }
-          ops.setValueAtIndex(runtime, i, touches);
+          // Call on touch callback
+          self->_touchCallback->call(runtime, ops, 1);
         }
-        // Call on touch callback
-        self->_touchCallback->call(runtime, ops, 1);
+        if (self->_touchBufferCallback != nullptr) {
+          self->callOnTouchBuffer(runtime);
+        }
+        self->_touchCallbackLock->unlock();
       }
-      self->_touchCallbackLock->unlock();
     });
   } else {
     // We'll try next time - schedule a new redraw
@@ -194,6 +269,61 @@ void RNSkDomRenderer::callOnTouch() {
   }
 }
 
+void RNSkDomRenderer::callOnTouchBuffer(jsi::Runtime &runtime) {
+  // Coalesce moves: walking backwards, a move is dropped when the same touch
+  // has a later move or end in this batch since only its last position is of
+  // interest.
+  std::vector<const RNSkTouchInfo *> rows;
+  std::unordered_map<size_t, bool> superseded;
+  for (auto touches = _touchesCache.rbegin(); touches != _touchesCache.rend();
+       ++touches) {
+    for (auto touch = touches->rbegin(); touch != touches->rend(); ++touch) {
+      auto &isSuperseded = superseded[touch->id];
+      if (touch->type == RNSkTouchInfo::Active) {
+        if (isSuperseded) {
+          continue;
+        }
+        isSuperseded = true;
+      } else {
+        isSuperseded = touch->type != RNSkTouchInfo::Start;
+      }
+      rows.push_back(&(*touch));
+    }
+  }
+
+  // Reuse the buffer between calls, it is only grown when needed
+  auto length = rows.size() * TouchBufferColumns;
+  auto byteLength = length * sizeof(double);
+  if (_touchBuffer == nullptr || _touchBuffer->size(runtime) < byteLength) {
+    auto capacity = _touchBuffer != nullptr ? 2 * _touchBuffer->size(runtime)
+                                            : 64 * sizeof(double);
+    capacity = std::max(capacity, byteLength);
+    _touchBuffer = std::make_shared<jsi::ArrayBuffer>(
+        runtime.global()
+            .getPropertyAsFunction(runtime, "ArrayBuffer")
+            .callAsConstructor(runtime, static_cast<double>(capacity))
+            .asObject(runtime)
+            .getArrayBuffer(runtime));
+  }
+
+  auto data = reinterpret_cast<double *>(_touchBuffer->data(runtime));
+  for (auto touch = rows.rbegin(); touch != rows.rend(); ++touch) {
+    *data++ = (*touch)->x;
+    *data++ = (*touch)->y;
+    *data++ = (*touch)->force;
+    *data++ = static_cast<double>((*touch)->type);
+    *data++ = static_cast<double>((*touch)->id);
+    *data++ = static_cast<double>((*touch)->timestamp) / 1000.0;
+  }
+
+  auto array =
+      runtime.global()
+          .getPropertyAsFunction(runtime, "Float64Array")
+          .callAsConstructor(runtime, jsi::Value(runtime, *_touchBuffer), 0.0,
+                             static_cast<double>(length));
+  _touchBufferCallback->call(runtime, array, 1);
+}
+
 void RNSkDomRenderer::renderDebugOverlays(SkCanvas *canvas) {
   if (!getShowDebugOverlays()) {
     return;
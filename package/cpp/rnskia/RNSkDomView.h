@@ -5,6 +5,7 @@
 #include <mutex>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <jsi/jsi.h>
@@ -13,6 +14,9 @@
 #include "RNSkView.h"
 
 #include "JsiDomRenderNode.h"
+#include "JsiSkData.h"
+#include "JsiSkPoint.h"
+#include "JsiSkRect.h"
 #include "RNSkInfoParameter.h"
 #include "RNSkLog.h"
 #include "RNSkPlatformContext.h"
@@ -23,6 +27,7 @@
 
 #include "SkBBHFactory.h"
 #include "SkCanvas.h"
+#include "SkData.h"
 #include "SkPictureRecorder.h"
 
 #pragma clang diagnostic pop
@@ -35,6 +40,16 @@ namespace RNSkia {
 class JsiSkCanvas;
 namespace jsi = facebook::jsi;
 
+/**
+ A captured frame of a DOM view: the node tree serialized to JSON and the
+ recorded picture, where the drawing of each node is enclosed in annotations
+ with its node id.
+ */
+struct RNSkDomCapture {
+  std::string tree;
+  sk_sp<SkData> picture;
+};
+
 class RNSkDomRenderer : public RNSkRenderer,
                         public std::enable_shared_from_this<RNSkDomRenderer> {
 public:
@@ -52,15 +67,41 @@ public:
 
   void setOnTouchCallback(std::shared_ptr<jsi::Function> onTouchCallback);
 
+  /**
+   Sets a callback that receives touches as a Float64Array with one row of
+   x, y, force, type, id and timestamp per touch. Moves between two calls are
+   coalesced to the last position of each touch. The array is backed by a
+   buffer that is reused, so it is only valid during the callback.
+   */
+  void setOnTouchBufferCallback(
+      std::shared_ptr<jsi::Function> onTouchBufferCallback);
+
   void updateTouches(std::vector<RNSkTouchInfo> &touches);
 
+  /**
+   Returns the ids of the nodes hit by the query, topmost first. The query is
+   in the coordinate space of the root node and is tested against what was
+   drawn in the last frame.
+   */
+  std::vector<size_t> hitTest(const HitTestQuery &query);
+
+  /**
+   Renders the current tree into a picture while recording the properties and
+   render times of each node, for profiling frames offline.
+   */
+  RNSkDomCapture capture(float scaledWidth, float scaledHeight);
+
 private:
+  void ensureDrawingContext();
   void callOnTouch();
+  void callOnTouchBuffer(jsi::Runtime &runtime);
   void renderCanvas(SkCanvas *canvas, float scaledWidth, float scaledHeight);
   void renderDebugOverlays(SkCanvas *canvas);
 
   std::shared_ptr<RNSkPlatformContext> _platformContext;
   std::shared_ptr<jsi::Function> _touchCallback;
+  std::shared_ptr<jsi::Function> _touchBufferCallback;
+  std::shared_ptr<jsi::ArrayBuffer> _touchBuffer;
 
   std::shared_ptr<std::timed_mutex> _renderLock;
   std::shared_ptr<std::timed_mutex> _touchCallbackLock;
@@ -74,6 +115,8 @@ private:
   std::vector<std::vector<RNSkTouchInfo>> _currentTouches;
   std::vector<std::vector<RNSkTouchInfo>> _touchesCache;
   std::mutex _rootLock;
+
+  static constexpr size_t TouchBufferColumns = 6;
 };
 
 class RNSkDomView : public RNSkView {
@@ -120,6 +163,18 @@ public:
         // Request redraw
         requestRedraw();
 
+      } else if (prop.first == "onTouchBuffer") {
+        if (prop.second.isUndefinedOrNull()) {
+          std::static_pointer_cast<RNSkDomRenderer>(getRenderer())
+              ->setOnTouchBufferCallback(nullptr);
+          continue;
+        } else if (prop.second.getType() != JsiWrapperValueType::Function) {
+          throw std::runtime_error(
+              "Expected a function for the onTouchBuffer property.");
+        }
+        std::static_pointer_cast<RNSkDomRenderer>(getRenderer())
+            ->setOnTouchBufferCallback(prop.second.getAsFunction());
+
       } else if (prop.first == "root") {
         // Save root
         if (prop.second.isUndefined() || prop.second.isNull()) {
@@ -136,5 +191,49 @@ public:
       }
     }
   }
+
+  jsi::Value callJsiMethod(jsi::Runtime &runtime, const std::string &name,
+                           const jsi::Value *arguments, size_t count) override {
+    if (name == "hitTest") {
+      if (count < 1 || !arguments[0].isObject()) {
+        throw std::runtime_error("hitTest: Expected a point or a rect.");
+      }
+      auto object = arguments[0].asObject(runtime);
+      auto isRect = object.isHostObject(runtime)
+                        ? object.isHostObject<JsiSkRect>(runtime)
+                        : object.hasProperty(runtime, "width");
+      auto query = HitTestQuery::MakeRect(SkRect::MakeEmpty());
+      if (isRect) {
+        query =
+            HitTestQuery::MakeRect(JsiSkRect::getRect(runtime, arguments[0]));
+      } else {
+        auto point = JsiSkPoint::getPoint(runtime, arguments[0]);
+        query = HitTestQuery::MakePoint(point.x(), point.y());
+      }
+
+      auto ids = std::static_pointer_cast<RNSkDomRenderer>(getRenderer())
+                     ->hitTest(query);
+      auto result = jsi::Array(runtime, ids.size());
+      for (size_t i = 0; i < ids.size(); i++) {
+        result.setValueAtIndex(runtime, i, static_cast<double>(ids[i]));
+      }
+      return result;
+    }
+    if (name == "capture") {
+      auto capture = std::static_pointer_cast<RNSkDomRenderer>(getRenderer())
+                         ->capture(getCanvasProvider()->getScaledWidth(),
+                                   getCanvasProvider()->getScaledHeight());
+      auto result = jsi::Object(runtime);
+      result.setProperty(runtime, "tree",
+                         jsi::String::createFromUtf8(runtime, capture.tree));
+      result.setProperty(runtime, "picture",
+                         capture.picture != nullptr
+                             ? JsiSkData::toUint8Array(
+                                   runtime, std::move(capture.picture))
+                             : jsi::Value::null());
+      return result;
+    }
+    return RNSkView::callJsiMethod(runtime, name, arguments, count);
+  }
 };
 } // namespace RNSkia
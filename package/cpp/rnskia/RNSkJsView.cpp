@@ -1,5 +1,6 @@
 #include <utility>
 
+#include "RNSkBatchingCanvas.h"
 #include "RNSkJsView.h"
 
 namespace RNSkia {
@@ -71,6 +72,15 @@ void RNSkJsRenderer::performDraw(
       recorder.beginRecording(canvasProvider->getScaledWidth(),
                               canvasProvider->getScaledHeight(), &factory);
 
+  // Merge draws before they end up in the picture if requested
+  std::unique_ptr<RNSkBatchingCanvas> batchingCanvas;
+  if (_optimizePictures) {
+    batchingCanvas = std::make_unique<RNSkBatchingCanvas>(
+        canvas, canvasProvider->getScaledWidth(),
+        canvasProvider->getScaledHeight());
+    canvas = batchingCanvas.get();
+  }
+
   _jsiCanvas->setCanvas(canvas);
 
   // Get current milliseconds
@@ -90,6 +100,9 @@ void RNSkJsRenderer::performDraw(
   }
 
   // Finish drawing operations
+  if (batchingCanvas != nullptr) {
+    batchingCanvas->flushBatch();
+  }
   auto p = recorder.finishRecordingAsPicture();
 
   _jsiCanvas->setCanvas(nullptr);
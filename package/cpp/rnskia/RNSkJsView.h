@@ -48,6 +48,15 @@ public:
 
   void setDrawCallback(std::shared_ptr<jsi::Function> drawCallback);
 
+  /**
+   When set, runs of simple shapes with the same paint are merged into single
+   draws while recording, which makes pictures with many small shapes cheaper
+   to play back.
+   */
+  void setOptimizePictures(bool optimizePictures) {
+    _optimizePictures = optimizePictures;
+  }
+
   std::shared_ptr<RNSkInfoObject> getInfoObject();
 
 private:
@@ -67,6 +76,7 @@ private:
   std::shared_ptr<RNSkInfoObject> _infoObject;
   RNSkTimingInfo _jsTimingInfo;
   RNSkTimingInfo _gpuTimingInfo;
+  bool _optimizePictures = false;
 };
 
 class RNSkJsView : public RNSkView {
@@ -114,6 +124,11 @@ public:
 
         // Request redraw
         requestRedraw();
+      } else if (prop.first == "optimize") {
+        std::static_pointer_cast<RNSkJsRenderer>(getRenderer())
+            ->setOptimizePictures(!prop.second.isUndefinedOrNull() &&
+                                  prop.second.getAsBool());
+        requestRedraw();
       }
     }
   }
@@ -11,6 +11,8 @@
 #include <RNSkView.h>
 
 #include <JsiDomApi.h>
+#include <RNSkPictureCache.h>
+#include <RNSkSurfacePool.h>
 #include <RuntimeAwareCache.h>
 
 namespace RNSkia {
@@ -49,6 +51,14 @@ void RNSkManager::invalidate() {
   // Invalidate members
   _viewApi->invalidate();
   _platformContext->invalidate();
+
+  // Pictures and surfaces of this runtime are not needed by the next one
+  RNSkPictureCache::getInstance().clear();
+  RNSkSurfacePool::getInstance().purgeUnused();
+}
+
+void RNSkManager::didReceiveMemoryWarning() {
+  RNSkSurfacePool::getInstance().purgeUnused();
 }
 
 void RNSkManager::registerSkiaView(size_t nativeId,
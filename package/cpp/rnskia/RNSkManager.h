@@ -38,6 +38,12 @@ public:
    */
   void invalidate();
 
+  /**
+   Releases the memory held by caches that can be rebuilt, called by the
+   platforms when the system is low on memory.
+   */
+  void didReceiveMemoryWarning();
+
   /**
    * Registers a RNSkView with the given native id
    * @param nativeId Native view id
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkParsePath.h"
+#include "SkPath.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+/**
+ Cache for paths parsed from SVG path strings. Icons and re-rendered
+ components pass the same strings over and over, so parsed paths are kept by
+ their string and shared (immutably) between all nodes and JS objects using
+ them. Entries are evicted in least recently used order when the memory budget
+ is exceeded.
+ */
+class RNSkPathCache {
+public:
+  struct Stats {
+    size_t hits;
+    size_t misses;
+    size_t entries;
+    size_t bytes;
+  };
+
+  static RNSkPathCache &getInstance() {
+    static RNSkPathCache instance;
+    return instance;
+  }
+
+  /**
+   Returns the path parsed from the SVG path string, or nullptr if the string
+   is not a valid path.
+   */
+  std::shared_ptr<const SkPath> getPath(const std::string &svgString) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto it = _entries.find(svgString);
+      if (it != _entries.end()) {
+        _hits++;
+        _lru.splice(_lru.begin(), _lru, it->second.position);
+        return it->second.path;
+      }
+      _misses++;
+    }
+
+    // Parse without holding the lock, long paths can take a while
+    SkPath result;
+    if (!SkParsePath::FromSVGString(svgString.c_str(), &result)) {
+      return nullptr;
+    }
+    auto path = std::make_shared<const SkPath>(std::move(result));
+    auto bytes = svgString.size() + path->approximateBytesUsed();
+    if (bytes > MaxEntryBytes) {
+      return path;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto inserted = _entries.emplace(svgString, Entry{path, bytes, {}});
+    if (!inserted.second) {
+      // Parsed by another thread in the meantime
+      return inserted.first->second.path;
+    }
+    _lru.push_front(&inserted.first->first);
+    inserted.first->second.position = _lru.begin();
+    _totalBytes += bytes;
+    evict();
+    return path;
+  }
+
+  /**
+   Returns the number of lookups that found or parsed their path, and the
+   number and size of the cached paths. Exposed to JS for profiling.
+   */
+  Stats getStats() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {_hits, _misses, _entries.size(), _totalBytes};
+  }
+
+private:
+  struct Entry {
+    std::shared_ptr<const SkPath> path;
+    size_t bytes;
+    std::list<const std::string *>::iterator position;
+  };
+
+  void evict() {
+    while ((_totalBytes > MaxTotalBytes || _entries.size() > MaxEntries) &&
+           _lru.size() > 1) {
+      auto it = _entries.find(*_lru.back());
+      _lru.pop_back();
+      _totalBytes -= it->second.bytes;
+      _entries.erase(it);
+    }
+  }
+
+  static constexpr size_t MaxTotalBytes = 8 * 1024 * 1024;
+  static constexpr size_t MaxEntryBytes = MaxTotalBytes / 8;
+  static constexpr size_t MaxEntries = 4096;
+
+  // The keys of the map are stable, the LRU list points to them
+  std::unordered_map<std::string, Entry> _entries;
+  std::list<const std::string *> _lru;
+  size_t _totalBytes = 0;
+  size_t _hits = 0;
+  size_t _misses = 0;
+  std::mutex _mutex;
+};
+
+} // namespace RNSkia
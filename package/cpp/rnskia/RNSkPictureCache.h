@@ -0,0 +1,131 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkData.h"
+#include "SkPicture.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+/**
+ Cache for pictures deserialized from .skp data. Pictures are immutable and
+ can be played back from any thread, so loading the same asset again (or the
+ same bytes from another source) returns the picture already deserialized
+ instead of parsing it again. Pictures are kept by their serialized bytes and
+ evicted in least recently used order when the memory budget is exceeded.
+ */
+class RNSkPictureCache {
+public:
+  static RNSkPictureCache &getInstance() {
+    static RNSkPictureCache instance;
+    return instance;
+  }
+
+  /**
+   Returns the picture serialized in the data, or nullptr if the data is not a
+   valid picture. Can be called from any thread. The data is only read during
+   the call, the cache keeps its own copy of the bytes, so the data can be a
+   view of memory owned by someone else.
+   */
+  sk_sp<SkPicture> getPicture(const sk_sp<SkData> &data) {
+    if (data == nullptr) {
+      return nullptr;
+    }
+    Key key = {std::hash<std::string_view>()(std::string_view(
+                   static_cast<const char *>(data->data()), data->size())),
+               data};
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto it = _entries.find(key);
+      if (it != _entries.end()) {
+        _lru.splice(_lru.begin(), _lru, it->second.position);
+        return it->second.picture;
+      }
+    }
+
+    // Deserialize without holding the lock, large pictures take a while
+    auto picture = SkPicture::MakeFromData(data.get());
+    if (picture == nullptr) {
+      return nullptr;
+    }
+    // The serialized bytes stay alive as part of the key
+    auto bytes = picture->approximateBytesUsed() + data->size();
+    if (bytes > MaxEntryBytes) {
+      return picture;
+    }
+    key.data = SkData::MakeWithCopy(data->data(), data->size());
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto inserted = _entries.emplace(key, Entry{picture, bytes, {}});
+    if (!inserted.second) {
+      // Deserialized by another thread in the meantime
+      return inserted.first->second.picture;
+    }
+    _lru.push_front(key);
+    inserted.first->second.position = _lru.begin();
+    _totalBytes += bytes;
+    while ((_totalBytes > MaxTotalBytes || _entries.size() > MaxEntries) &&
+           _lru.size() > 1) {
+      auto it = _entries.find(_lru.back());
+      _lru.pop_back();
+      _totalBytes -= it->second.bytes;
+      _entries.erase(it);
+    }
+    return picture;
+  }
+
+  /**
+   Releases all the cached pictures, for instance when the Javascript runtime
+   is torn down.
+   */
+  void clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.clear();
+    _lru.clear();
+    _totalBytes = 0;
+  }
+
+private:
+  struct Key {
+    size_t hash;
+    sk_sp<SkData> data;
+
+    // Hashes can collide, the bytes are compared before a picture is reused
+    bool operator==(const Key &other) const {
+      return hash == other.hash && data->equals(other.data.get());
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const { return key.hash; }
+  };
+
+  struct Entry {
+    sk_sp<SkPicture> picture;
+    size_t bytes;
+    std::list<Key>::iterator position;
+  };
+
+  static constexpr size_t MaxTotalBytes = 32 * 1024 * 1024;
+  static constexpr size_t MaxEntryBytes = MaxTotalBytes / 4;
+  static constexpr size_t MaxEntries = 256;
+
+  std::unordered_map<Key, Entry, KeyHash> _entries;
+  std::list<Key> _lru;
+  size_t _totalBytes = 0;
+  std::mutex _mutex;
+};
+
+} // namespace RNSkia
@@ -9,7 +9,7 @@
 #include <unordered_map>
 #include <utility>
 
-#include "RNSkDispatchQueue.h"
+#include "RNSkThreadPool.h"
 
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdocumentation"
@@ -40,8 +40,8 @@ public:
                       float pixelDensity)
       : _pixelDensity(pixelDensity), _jsRuntime(runtime),
         _callInvoker(callInvoker),
-        _dispatchQueue(
-            std::make_unique<RNSkDispatchQueue>("skia-render-thread")) {
+        _threadPool(std::make_unique<RNSkThreadPool>(
+            "skia", getWorkerThreadCount())) {
     _jsThreadId = std::this_thread::get_id();
   }
 
@@ -81,13 +81,50 @@ public:
   }
 
   /**
-   Runs the function on the render thread
+   Runs the function on the render thread. Functions run in the order they
+   were passed, and always on the same thread, so this is where GPU contexts
+   are used.
    */
-  void runOnRenderThread(std::function<void()> func) {
+  void runOnRenderThread(RNSkTask func) {
     if (!_isValid) {
       return;
     }
-    _dispatchQueue->dispatch(std::move(func));
+    _threadPool->dispatchToRenderThread(std::move(func));
+  }
+
+  /**
+   Runs the function on one of the worker threads. Workers are meant for
+   splitting up work, like recording independent parts of a frame, that the
+   calling thread then waits for.
+   */
+  void runOnWorkerThread(RNSkTask func) {
+    if (!_isValid) {
+      return;
+    }
+    _threadPool->dispatch(std::move(func), RNSkThreadPool::Priority::Present);
+  }
+
+  /**
+   Runs the function on one of the worker threads when no work for
+   presenting frames is waiting. Used for work like decoding and encoding
+   that should never delay a frame.
+   */
+  void runInBackground(RNSkTask func) {
+    if (!_isValid) {
+      return;
+    }
+    _threadPool->dispatch(std::move(func),
+                          RNSkThreadPool::Priority::Background);
+  }
+
+  /**
+   Returns the number of worker threads. Together with the render thread, the
+   pool has one thread per core.
+   */
+  static size_t getWorkerThreadCount() {
+    // The render thread, which also waits for the workers, takes one core
+    auto cores = std::thread::hardware_concurrency();
+    return cores > 2 ? cores - 1 : 1;
   }
 
   /**
@@ -234,7 +271,7 @@ private:
 
   jsi::Runtime *_jsRuntime;
   std::shared_ptr<react::CallInvoker> _callInvoker;
-  std::unique_ptr<RNSkDispatchQueue> _dispatchQueue;
+  std::unique_ptr<RNSkThreadPool> _threadPool;
 
   std::unordered_map<size_t, std::function<void(bool)>> _drawCallbacks;
   std::mutex _drawCallbacksLock;
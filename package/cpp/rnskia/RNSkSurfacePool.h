@@ -0,0 +1,186 @@
+#pragma once
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkCanvas.h"
+#include "SkImageInfo.h"
+#include "SkRect.h"
+#include "SkSurface.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+/**
+ Pool of raster surfaces. Offscreen drawing like thumbnails and snapshots
+ creates and drops surfaces of the same size over and over, so surfaces are
+ kept after their last user releases them and handed out again, cleared, for
+ the next request with the same size and color type.
+
+ Pooled surfaces own their pixels, so images snapshotted from them share the
+ pixels with the surface. Skia only copies the pixels if the surface is drawn
+ to again while such an image is alive, which is also what happens when a
+ surface is reused.
+
+ Unused surfaces are released once they haven't been handed out for a while,
+ and all of them on memory warnings.
+ */
+class RNSkSurfacePool {
+public:
+  static RNSkSurfacePool &getInstance() {
+    // Never destroyed, surfaces can still be released during shutdown
+    static auto instance = new RNSkSurfacePool();
+    return *instance;
+  }
+
+  /**
+   Returns a raster surface cleared to transparent, or nullptr if the size or
+   color type is not valid. Can be called from any thread.
+   */
+  sk_sp<SkSurface> makeRasterSurface(int width, int height,
+                                     SkColorType colorType = kN32_SkColorType) {
+    auto info =
+        SkImageInfo::Make(width, height, colorType, kPremul_SkAlphaType);
+    if (width <= 0 || height <= 0 || info.bytesPerPixel() == 0) {
+      return nullptr;
+    }
+    // SIZE_MAX if the size overflows, which is never pooled either
+    auto bytes = info.computeMinByteSize();
+    if (bytes > MaxEntryBytes) {
+      return SkSurface::MakeRaster(info);
+    }
+
+    auto surface = acquire(info);
+    if (surface != nullptr) {
+      return surface;
+    }
+    surface = SkSurface::MakeRaster(info);
+    if (surface != nullptr) {
+      add(surface, bytes);
+    }
+    return surface;
+  }
+
+  /**
+   Releases the pooled surfaces that are not in use, for instance on memory
+   warnings or when the Javascript runtime is torn down.
+   */
+  void purgeUnused() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    purgeUnused(Clock::time_point::max());
+  }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry {
+    sk_sp<SkSurface> surface;
+    size_t bytes;
+    Clock::time_point lastUsed;
+  };
+
+  /**
+   Releases the unused surfaces last handed out before the given time. Must
+   be called with the lock held.
+   */
+  void purgeUnused(Clock::time_point before) {
+    for (auto it = _entries.begin(); it != _entries.end();) {
+      if (it->surface->unique() && it->lastUsed < before) {
+        _totalBytes -= it->bytes;
+        it = _entries.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  sk_sp<SkSurface> acquire(const SkImageInfo &info) {
+    sk_sp<SkSurface> surface;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto now = Clock::now();
+      purgeUnused(now - MaxIdleTime);
+      for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+        // Only the pool references a surface nobody uses anymore
+        if (it->surface->unique() && it->surface->imageInfo() == info) {
+          surface = it->surface;
+          it->lastUsed = now;
+          _entries.splice(_entries.begin(), _entries, it);
+          break;
+        }
+      }
+    }
+    // The reference taken above keeps other threads from acquiring it
+    if (surface == nullptr || reset(surface.get())) {
+      return surface;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (auto it = _entries.begin(); it != _entries.end(); ++it) {
+      if (it->surface == surface) {
+        _totalBytes -= it->bytes;
+        _entries.erase(it);
+        break;
+      }
+    }
+    return nullptr;
+  }
+
+  void add(const sk_sp<SkSurface> &surface, size_t bytes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.push_front({surface, bytes, Clock::now()});
+    _totalBytes += bytes;
+    // Evict unused surfaces, least recently used first
+    auto it = _entries.end();
+    while (it != _entries.begin() &&
+           (_totalBytes > MaxTotalBytes || _entries.size() > MaxEntries)) {
+      --it;
+      if (it->surface->unique()) {
+        _totalBytes -= it->bytes;
+        it = _entries.erase(it);
+      }
+    }
+    if (_totalBytes > MaxTotalBytes || _entries.size() > MaxEntries) {
+      // Every pooled surface is in use, don't keep this one
+      _totalBytes -= bytes;
+      _entries.pop_front();
+    }
+  }
+
+  /**
+   Brings the canvas of a surface back to its initial state and clears it.
+   Returns false if that is not possible.
+   */
+  static bool reset(SkSurface *surface) {
+    auto canvas = surface->getCanvas();
+    canvas->restoreToCount(1);
+    canvas->resetMatrix();
+    // A clip set outside of save() and restore() can't be removed
+    if (!canvas->isClipRect() ||
+        canvas->getDeviceClipBounds() !=
+            SkIRect::MakeWH(surface->width(), surface->height())) {
+      return false;
+    }
+    // Copies the pixels first if a snapshot still shares them
+    canvas->clear(SK_ColorTRANSPARENT);
+    return true;
+  }
+
+  static constexpr size_t MaxTotalBytes = 64 * 1024 * 1024;
+  static constexpr size_t MaxEntryBytes = MaxTotalBytes / 4;
+  static constexpr size_t MaxEntries = 64;
+  static constexpr std::chrono::seconds MaxIdleTime{30};
+
+  // Pooled surfaces, in use or not, most recently used first
+  std::list<Entry> _entries;
+  size_t _totalBytes = 0;
+  std::mutex _mutex;
+};
+
+} // namespace RNSkia
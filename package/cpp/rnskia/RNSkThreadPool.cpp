@@ -0,0 +1,158 @@
+#include "RNSkThreadPool.h"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace RNSkia {
+
+namespace {
+// The pool and index of the pool thread running on the current thread
+thread_local RNSkThreadPool *CurrentPool = nullptr;
+thread_local size_t CurrentIndex = 0;
+} // namespace
+
+RNSkThreadPool::RNSkThreadPool(std::string name, size_t workerCount)
+    : _name(std::move(name)) {
+  for (auto &pending : _pending) {
+    pending = 0;
+  }
+  for (auto &queued : _queued) {
+    queued = 0;
+  }
+  for (size_t i = 0; i < workerCount + 1; i++) {
+    _workers.push_back(std::make_unique<Worker>());
+  }
+  for (size_t i = 0; i < workerCount + 1; i++) {
+    _threads.emplace_back(&RNSkThreadPool::run, this, i);
+  }
+}
+
+RNSkThreadPool::~RNSkThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+    _quit = true;
+  }
+  _wakeUp.notify_all();
+
+  for (auto &thread : _threads) {
+    if (thread.joinable()) {
+      thread.join();
+    }
+  }
+}
+
+void RNSkThreadPool::dispatch(RNSkTask &&task, Priority priority) {
+  auto index = static_cast<size_t>(priority);
+  _pending[index]++;
+
+  // Tasks dispatched from a pool thread stay on it unless they are stolen
+  if (CurrentPool != this ||
+      !_workers[CurrentIndex]->deques[index].push(&task)) {
+    std::lock_guard<std::mutex> lock(_queueMutex);
+    _queues[index].push_back(std::move(task));
+    _queued[index]++;
+  }
+  wake();
+}
+
+void RNSkThreadPool::dispatchToRenderThread(RNSkTask &&task) {
+  {
+    std::lock_guard<std::mutex> lock(_queueMutex);
+    _renderQueue.push_back(std::move(task));
+  }
+  _renderPending++;
+  wake();
+}
+
+void RNSkThreadPool::wake() {
+  // Only take the lock when a thread might be waiting
+  if (_sleeping > 0) {
+    std::lock_guard<std::mutex> lock(_sleepMutex);
+    _wakeUp.notify_all();
+  }
+}
+
+void RNSkThreadPool::run(size_t index) {
+  CurrentPool = this;
+  CurrentIndex = index;
+
+  while (!_quit) {
+    if (runNext(index)) {
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(_sleepMutex);
+    _sleeping++;
+    _wakeUp.wait(lock, [this, index] { return _quit || hasWork(index); });
+    _sleeping--;
+  }
+}
+
+bool RNSkThreadPool::runNext(size_t index) {
+  RNSkTask task;
+  if (index == RenderThread && _renderPending > 0) {
+    {
+      std::lock_guard<std::mutex> lock(_queueMutex);
+      if (!_renderQueue.empty()) {
+        task = std::move(_renderQueue.front());
+        _renderQueue.pop_front();
+      }
+    }
+    if (task) {
+      _renderPending--;
+      task();
+      return true;
+    }
+  }
+
+  for (size_t priority = 0; priority < PriorityCount; priority++) {
+    if (index == RenderThread &&
+        priority == static_cast<size_t>(Priority::Background)) {
+      break;
+    }
+    if (findTask(index, priority, &task)) {
+      _pending[priority]--;
+      task();
+      return true;
+    }
+  }
+  return false;
+}
+
+bool RNSkThreadPool::findTask(size_t index, size_t priority, RNSkTask *task) {
+  // Newest task of our own first, since its data is likely still in cache
+  if (_workers[index]->deques[priority].pop(task)) {
+    return true;
+  }
+
+  if (_queued[priority] > 0) {
+    std::lock_guard<std::mutex> lock(_queueMutex);
+    if (!_queues[priority].empty()) {
+      *task = std::move(_queues[priority].front());
+      _queues[priority].pop_front();
+      _queued[priority]--;
+      return true;
+    }
+  }
+
+  // Steal the oldest task of another thread
+  for (size_t i = 1; i < _workers.size(); i++) {
+    auto victim = (index + i) % _workers.size();
+    if (_workers[victim]->deques[priority].steal(task)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool RNSkThreadPool::hasWork(size_t index) {
+  if (index == RenderThread) {
+    return _renderPending > 0 ||
+           _pending[static_cast<size_t>(Priority::Present)] > 0;
+  }
+  return _pending[static_cast<size_t>(Priority::Present)] > 0 ||
+         _pending[static_cast<size_t>(Priority::Background)] > 0;
+}
+
+} // namespace RNSkia
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace RNSkia {
+
+/**
+ Move-only callable for tasks run by the thread pool. Callables that fit in
+ the inline buffer (which covers lambdas capturing a handful of smart
+ pointers) are stored without allocating.
+ */
+class RNSkTask {
+public:
+  static constexpr size_t InlineSize = 64;
+
+  RNSkTask() = default;
+
+  template <typename F, typename = std::enable_if_t<
+                            !std::is_same<std::decay_t<F>, RNSkTask>::value>>
+  RNSkTask(F &&func) { // NOLINT(runtime/explicit)
+    using Fn = std::decay_t<F>;
+    if constexpr (sizeof(Fn) <= InlineSize &&
+                  alignof(Fn) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible<Fn>::value) {
+      new (_storage) Fn(std::forward<F>(func));
+      _ops = &InlineOps<Fn>::ops;
+    } else {
+      *reinterpret_cast<Fn **>(_storage) = new Fn(std::forward<F>(func));
+      _ops = &HeapOps<Fn>::ops;
+    }
+  }
+
+  RNSkTask(RNSkTask &&other) noexcept { moveFrom(&other); }
+
+  RNSkTask &operator=(RNSkTask &&other) noexcept {
+    if (this != &other) {
+      reset();
+      moveFrom(&other);
+    }
+    return *this;
+  }
+
+  RNSkTask(const RNSkTask &) = delete;
+  RNSkTask &operator=(const RNSkTask &) = delete;
+
+  ~RNSkTask() { reset(); }
+
+  explicit operator bool() const { return _ops != nullptr; }
+
+  void operator()() { _ops->invoke(_storage); }
+
+  void reset() {
+    if (_ops != nullptr) {
+      _ops->destroy(_storage);
+      _ops = nullptr;
+    }
+  }
+
+private:
+  struct Ops {
+    void (*invoke)(void *storage);
+    void (*move)(void *dst, void *src);
+    void (*destroy)(void *storage);
+  };
+
+  template <typename Fn> struct InlineOps {
+    static void invoke(void *storage) { (*static_cast<Fn *>(storage))(); }
+    static void move(void *dst, void *src) {
+      new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+      static_cast<Fn *>(src)->~Fn();
+    }
+    static void destroy(void *storage) { static_cast<Fn *>(storage)->~Fn(); }
+    static constexpr Ops ops = {invoke, move, destroy};
+  };
+
+  template <typename Fn> struct HeapOps {
+    static void invoke(void *storage) { (**static_cast<Fn **>(storage))(); }
+    static void move(void *dst, void *src) {
+      *static_cast<Fn **>(dst) = *static_cast<Fn **>(src);
+    }
+    static void destroy(void *storage) { delete *static_cast<Fn **>(storage); }
+    static constexpr Ops ops = {invoke, move, destroy};
+  };
+
+  void moveFrom(RNSkTask *other) {
+    if (other->_ops != nullptr) {
+      other->_ops->move(_storage, other->_storage);
+      _ops = other->_ops;
+      other->_ops = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) unsigned char _storage[InlineSize];
+  const Ops *_ops = nullptr;
+};
+
+/**
+ Fixed size work stealing deque (Chase-Lev). The owning thread pushes and
+ pops at the bottom without locking, other threads steal from the top. A slot
+ is only reused once the thread that took its task has moved it out, push
+ returns false when the deque is full.
+ */
+class RNSkWorkDeque {
+public:
+  static constexpr int64_t Capacity = 256;
+
+  /**
+   Pushes a task, must only be called by the owning thread.
+   */
+  bool push(RNSkTask *task) {
+    auto bottom = _bottom.load(std::memory_order_relaxed);
+    auto top = _top.load(std::memory_order_acquire);
+    auto &slot = _slots[bottom % Capacity];
+    if (bottom - top >= Capacity ||
+        slot.isFull.load(std::memory_order_acquire)) {
+      return false;
+    }
+    slot.task = std::move(*task);
+    slot.isFull.store(true, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   Pops the most recently pushed task, must only be called by the owning
+   thread.
+   */
+  bool pop(RNSkTask *task) {
+    auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto top = _top.load(std::memory_order_relaxed);
+    if (top > bottom) {
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+      return false;
+    }
+    if (top == bottom) {
+      // Last task, race against thieves for it
+      auto won = _top.compare_exchange_strong(
+          top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+      if (!won) {
+        return false;
+      }
+    }
+    take(bottom, task);
+    return true;
+  }
+
+  /**
+   Steals the oldest task, can be called from any thread.
+   */
+  bool steal(RNSkTask *task) {
+    auto top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto bottom = _bottom.load(std::memory_order_acquire);
+    if (top >= bottom) {
+      return false;
+    }
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return false;
+    }
+    take(top, task);
+    return true;
+  }
+
+private:
+  struct Slot {
+    RNSkTask task;
+    std::atomic<bool> isFull = {false};
+  };
+
+  void take(int64_t index, RNSkTask *task) {
+    auto &slot = _slots[index % Capacity];
+    *task = std::move(slot.task);
+    slot.isFull.store(false, std::memory_order_release);
+  }
+
+  std::atomic<int64_t> _top = {0};
+  std::atomic<int64_t> _bottom = {0};
+  std::array<Slot, Capacity> _slots;
+};
+
+/**
+ Thread pool shared by rendering and background work.
+
+ - Tasks have a priority. Present tasks are part of getting a frame on
+   screen and always run before background tasks (like decoding or
+   encoding images).
+ - Tasks dispatched from a pool thread go to that thread's own lock free
+   deque, idle threads steal from the other threads' deques. Tasks from other
+   threads go through a shared queue.
+ - Thread 0 is the render thread. Tasks with affinity to it (like everything
+   touching a GPU context) run there in the order they were dispatched. It
+   helps with present tasks, but never runs background tasks so that these
+   can't delay presenting a frame.
+ */
+class RNSkThreadPool {
+public:
+  enum class Priority { Present = 0, Background = 1 };
+
+  static constexpr size_t RenderThread = 0;
+
+  /**
+   Creates a pool with the render thread and the given number of worker
+   threads.
+   */
+  RNSkThreadPool(std::string name, size_t workerCount);
+
+  ~RNSkThreadPool();
+
+  /**
+   Runs the task on any thread in the pool.
+   */
+  void dispatch(RNSkTask &&task, Priority priority = Priority::Present);
+
+  /**
+   Runs the task on the render thread, after the tasks that were dispatched to
+   it before.
+   */
+  void dispatchToRenderThread(RNSkTask &&task);
+
+  size_t getWorkerCount() { return _threads.size() - 1; }
+
+  RNSkThreadPool(const RNSkThreadPool &) = delete;
+  RNSkThreadPool &operator=(const RNSkThreadPool &) = delete;
+
+private:
+  static constexpr size_t PriorityCount = 2;
+
+  struct Worker {
+    std::array<RNSkWorkDeque, PriorityCount> deques;
+  };
+
+  void run(size_t index);
+  bool runNext(size_t index);
+  bool findTask(size_t index, size_t priority, RNSkTask *task);
+  bool hasWork(size_t index);
+  void wake();
+
+  std::string _name;
+  std::vector<std::thread> _threads;
+  std::vector<std::unique_ptr<Worker>> _workers;
+
+  std::mutex _queueMutex;
+  std::array<std::deque<RNSkTask>, PriorityCount> _queues;
+  std::array<std::atomic<size_t>, PriorityCount> _queued;
+  std::deque<RNSkTask> _renderQueue;
+
+  // Tasks waiting to run, used to decide when threads can sleep
+  std::array<std::atomic<size_t>, PriorityCount> _pending;
+  std::atomic<size_t> _renderPending = {0};
+
+  std::mutex _sleepMutex;
+  std::condition_variable _wakeUp;
+  std::atomic<size_t> _sleeping = {0};
+  std::atomic<bool> _quit = {false};
+};
+
+} // namespace RNSkia
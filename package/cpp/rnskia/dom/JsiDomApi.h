@@ -10,6 +10,7 @@
 
 #include "base/JsiDependencyManager.h"
 
+#include "nodes/JsiAtlasNode.h"
 #include "nodes/JsiCircleNode.h"
 #include "nodes/JsiDiffRectNode.h"
 #include "nodes/JsiFillNode.h"
@@ -84,6 +85,7 @@ public:
     installFunction("ImageSVGNode", JsiImageSvgNode::createCtor(context));
 
     installFunction("VerticesNode", JsiVerticesNode::createCtor(context));
+    installFunction("AtlasNode", JsiAtlasNode::createCtor(context));
 
     // Path effects
     installFunction("DashPathEffectNode",
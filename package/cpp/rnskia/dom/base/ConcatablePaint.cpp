@@ -8,7 +8,7 @@ namespace RNSkia {
 
 ConcatablePaint::ConcatablePaint(
     DeclarationContext *declarationContext, PaintProps *paintProps,
-    const std::vector<std::shared_ptr<JsiDomNode>> &children)
+    const std::vector<JsiDomNode *> &children)
     : _declarationContext(declarationContext), _paintProps(paintProps),
       _children(children) {
 
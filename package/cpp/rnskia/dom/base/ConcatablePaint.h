@@ -27,14 +27,14 @@ class DeclarationContext;
 class ConcatablePaint {
 public:
   ConcatablePaint(DeclarationContext *context, PaintProps *paintProps,
-                  const std::vector<std::shared_ptr<JsiDomNode>> &children);
+                  const std::vector<JsiDomNode *> &children);
 
   void concatTo(std::shared_ptr<SkPaint> paint);
   bool isEmpty();
 
 private:
   DeclarationContext *_declarationContext;
-  const std::vector<std::shared_ptr<JsiDomNode>> _children;
+  const std::vector<JsiDomNode *> &_children;
   PaintProps *_paintProps;
 
   bool _isEmpty{true};
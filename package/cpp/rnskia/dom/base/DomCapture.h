@@ -0,0 +1,224 @@
+#pragma once
+
+#include "JsiDomNode.h"
+#include "JsiDomRenderNode.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace RNSkia {
+
+/**
+ Serializes a DOM tree to JSON after it has been rendered in a captured frame.
+ For each node the type, the node id and the resolved property values are
+ written, and for render nodes also the bounds (in the local coordinate space
+ of the parent, not in device space) and the time spent rendering the node.
+ Together with the picture recorded in the same frame, where the drawing of
+ each node is marked with annotations, this lets a frame be replayed and
+ profiled offline.
+ */
+class DomCapture {
+public:
+  explicit DomCapture(size_t captureId) : _captureId(captureId) {}
+
+  std::string serialize(std::shared_ptr<JsiDomNode> root) {
+    std::string json;
+    writeNode(root, &json);
+    return json;
+  }
+
+  static void writeString(const std::string &value, std::string *json) {
+    json->push_back('"');
+    for (auto c : value) {
+      switch (c) {
+      case '"':
+        json->append("\\\"");
+        break;
+      case '\\':
+        json->append("\\\\");
+        break;
+      case '\n':
+        json->append("\\n");
+        break;
+      case '\r':
+        json->append("\\r");
+        break;
+      case '\t':
+        json->append("\\t");
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          json->append(escaped);
+        } else {
+          json->push_back(c);
+        }
+      }
+    }
+    json->push_back('"');
+  }
+
+private:
+  void writeNode(std::shared_ptr<JsiDomNode> node, std::string *json) {
+    json->append("{\"type\":");
+    writeString(node->getType(), json);
+    json->append(",\"nodeId\":" + std::to_string(node->getNodeId()));
+
+    json->append(",\"props\":{");
+    auto first = true;
+    node->getPropsContainer()->enumerateMappedProps(
+        [&](const PropId name, const std::vector<NodeProp *> props) {
+          // All props mapped to the same name hold the same value
+          if (props.empty() || !props[0]->isSet()) {
+            return;
+          }
+          if (!first) {
+            json->push_back(',');
+          }
+          first = false;
+          writeString(name, json);
+          json->push_back(':');
+          writeValue(props[0]->value(), json);
+        });
+    json->push_back('}');
+
+    if (node->getNodeClass() == NodeClass::RenderNode) {
+      writeRenderInfo(std::static_pointer_cast<JsiDomRenderNode>(node), json);
+    }
+
+    json->append(",\"children\":[");
+    first = true;
+    for (auto &child : node->getChildren()) {
+      if (!first) {
+        json->push_back(',');
+      }
+      first = false;
+      writeNode(child, json);
+    }
+    json->append("]}");
+  }
+
+  void writeRenderInfo(std::shared_ptr<JsiDomRenderNode> node,
+                       std::string *json) {
+    JsiDomRenderNode::CaptureInfo info;
+    if (!node->getCaptureInfo(_captureId, &info)) {
+      json->append(",\"rendered\":false");
+      return;
+    }
+
+    // Self time excludes the time spent in child render nodes
+    auto selfTime = info.renderTime;
+    for (auto &child : node->getChildren()) {
+      JsiDomRenderNode::CaptureInfo childInfo;
+      if (child->getNodeClass() == NodeClass::RenderNode &&
+          std::static_pointer_cast<JsiDomRenderNode>(child)->getCaptureInfo(
+              _captureId, &childInfo)) {
+        selfTime -= childInfo.renderTime;
+      }
+    }
+
+    json->append(",\"rendered\":true");
+    json->append(",\"culled\":");
+    json->append(info.isCulled ? "true" : "false");
+    json->append(",\"renderTime\":");
+    writeNumber(info.renderTime, json);
+    json->append(",\"selfTime\":");
+    writeNumber(std::max(0.0, selfTime), json);
+
+    SkRect bounds;
+    if (node->getBounds(&bounds)) {
+      json->append(",\"bounds\":[");
+      writeNumber(bounds.left(), json);
+      json->push_back(',');
+      writeNumber(bounds.top(), json);
+      json->push_back(',');
+      writeNumber(bounds.width(), json);
+      json->push_back(',');
+      writeNumber(bounds.height(), json);
+      json->push_back(']');
+    }
+  }
+
+  static void writeNumber(double value, std::string *json) {
+    if (!std::isfinite(value)) {
+      json->append("null");
+      return;
+    }
+    char buffer[32];
+    snprintf(buffer, sizeof(buffer), "%.9g", value);
+    json->append(buffer);
+  }
+
+  static void writeValue(const JsiValue &value, std::string *json) {
+    switch (value.getType()) {
+    case PropType::Undefined:
+    case PropType::Null:
+      json->append("null");
+      break;
+    case PropType::Bool:
+      json->append(value.getAsBool() ? "true" : "false");
+      break;
+    case PropType::Number:
+      writeNumber(value.getAsNumber(), json);
+      break;
+    case PropType::String:
+      writeString(value.getAsString(), json);
+      break;
+    case PropType::Array: {
+      json->push_back('[');
+      auto first = true;
+      for (auto &item : value.getAsArray()) {
+        if (!first) {
+          json->push_back(',');
+        }
+        first = false;
+        writeValue(item, json);
+      }
+      json->push_back(']');
+      break;
+    }
+    case PropType::Float32Array: {
+      json->push_back('[');
+      auto first = true;
+      for (auto item : value.getAsFloat32Array()) {
+        if (!first) {
+          json->push_back(',');
+        }
+        first = false;
+        writeNumber(item, json);
+      }
+      json->push_back(']');
+      break;
+    }
+    case PropType::Object: {
+      json->push_back('{');
+      auto first = true;
+      for (auto key : value.getKeys()) {
+        if (!first) {
+          json->push_back(',');
+        }
+        first = false;
+        writeString(key, json);
+        json->push_back(':');
+        writeValue(value.getValue(key), json);
+      }
+      json->push_back('}');
+      break;
+    }
+    case PropType::HostObject:
+    case PropType::HostFunction:
+      // Host objects are captured in the picture, only the type is written
+      writeString(JsiValue::getTypeAsString(value.getType()), json);
+      break;
+    }
+  }
+
+  size_t _captureId;
+};
+
+} // namespace RNSkia
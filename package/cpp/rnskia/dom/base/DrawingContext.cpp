@@ -17,10 +17,21 @@ DrawingContext::DrawingContext(std::shared_ptr<SkPaint> paint) {
 DrawingContext::DrawingContext()
     : DrawingContext(std::make_shared<SkPaint>()) {}
 
-bool DrawingContext::saveAndConcat(
-    PaintProps *paintProps,
-    const std::vector<std::shared_ptr<JsiDomNode>> &children,
-    std::shared_ptr<SkPaint> paintCache) {
+std::shared_ptr<DrawingContext> DrawingContext::makeTaskContext() {
+  auto context = std::make_shared<DrawingContext>();
+  // Share the paint object so that paint caches in the subtree stay valid
+  context->_paints.clear();
+  context->_paints.push_back(getPaint());
+  context->_isTaskContext = true;
+  context->setScaledWidth(getScaledWidth());
+  context->setScaledHeight(getScaledHeight());
+  context->setRequestRedraw(std::function<void()>(getRequestRedraw()));
+  return context;
+}
+
+bool DrawingContext::saveAndConcat(PaintProps *paintProps,
+                                   const std::vector<JsiDomNode *> &children,
+                                   std::shared_ptr<SkPaint> paintCache) {
 
   if (paintCache) {
     _paints.push_back(paintCache);
@@ -38,11 +49,26 @@ bool DrawingContext::saveAndConcat(
 }
 
 void DrawingContext::save() {
-  // Copy paint and push
-  _paints.push_back(std::make_shared<SkPaint>(*getPaint()));
+  // Copy paint and push, reusing a paint released by restore if there is one
+  if (_freePaints.empty()) {
+    _paints.push_back(std::make_shared<SkPaint>(*getPaint()));
+    return;
+  }
+  auto paint = std::move(_freePaints.back());
+  _freePaints.pop_back();
+  *paint = *getPaint();
+  _paints.push_back(std::move(paint));
 }
 
-void DrawingContext::restore() { _paints.pop_back(); }
+void DrawingContext::restore() {
+  // A paint only referenced by the stack isn't held by any paint, bounds or
+  // hit test cache, so its identity doesn't matter and it can be reused.
+  auto &paint = _paints.back();
+  if (paint.use_count() == 1) {
+    _freePaints.push_back(std::move(paint));
+  }
+  _paints.pop_back();
+}
 
 SkCanvas *DrawingContext::getCanvas() { return _canvas; }
 
@@ -38,7 +38,26 @@ public:
 
   const std::function<void()> &getRequestRedraw() { return _requestRedraw; }
 
+  /**
+   When set, render nodes measure how long they take to render and mark what
+   they draw with annotations so that captured frames can be profiled.
+   */
+  void setCapturing(bool capturing) {
+    _isCapturing = capturing;
+    if (capturing) {
+      _captureId++;
+    }
+  }
+  bool isCapturing() { return _isCapturing; }
+
+  /**
+   Identifies the last captured frame
+   */
+  size_t getCaptureId() { return _captureId; }
+
 private:
+  bool _isCapturing = false;
+  size_t _captureId = 0;
   float _scaledWidth = -1;
   float _scaledHeight = -1;
   std::function<void()> _requestRedraw;
@@ -58,10 +77,23 @@ public:
   explicit DrawingContext(std::shared_ptr<SkPaint> paint);
 
   /**
-   Factory for saving/restoring the context for a node
+   Creates a context for rendering a subtree on another thread. It starts with
+   the current paint of this context and has its own paint and declaration
+   stacks.
+   */
+  std::shared_ptr<DrawingContext> makeTaskContext();
+
+  /**
+   Returns true if this context renders a subtree on another thread
+   */
+  bool isTaskContext() { return _isTaskContext; }
+
+  /**
+   Factory for saving/restoring the context for a node. Children are the
+   declaration children of the node.
    */
   bool saveAndConcat(PaintProps *paintProps,
-                     const std::vector<std::shared_ptr<JsiDomNode>> &children,
+                     const std::vector<JsiDomNode *> &children,
                      std::shared_ptr<SkPaint> paintCache);
   void restore();
 
@@ -97,7 +129,9 @@ private:
 
   explicit DrawingContext(const char *source);
   SkCanvas *_canvas = nullptr;
+  bool _isTaskContext = false;
   std::vector<std::shared_ptr<SkPaint>> _paints;
+  std::vector<std::shared_ptr<SkPaint>> _freePaints;
   std::unique_ptr<DeclarationContext> _declarationContext;
 };
 
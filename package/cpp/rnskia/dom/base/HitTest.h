@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkMatrix.h"
+#include "SkRect.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+/**
+ A point or a rect to hit test against the render tree. A rect query hits all
+ nodes that intersect it.
+ */
+class HitTestQuery {
+public:
+  static HitTestQuery MakePoint(SkScalar x, SkScalar y) {
+    return HitTestQuery(SkRect::MakeXYWH(x, y, 0, 0), true);
+  }
+
+  static HitTestQuery MakeRect(const SkRect &rect) {
+    return HitTestQuery(rect, false);
+  }
+
+  bool isPoint() const { return _isPoint; }
+  SkPoint getPoint() const { return {_rect.x(), _rect.y()}; }
+  const SkRect &getRect() const { return _rect; }
+
+  /**
+   Returns true if the query hits the rect.
+   */
+  bool intersects(const SkRect &rect) const {
+    return _isPoint ? rect.contains(_rect.x(), _rect.y())
+                    : SkRect::Intersects(rect, _rect);
+  }
+
+  /**
+   Maps the query into the space that the matrix maps from. Rects are mapped
+   to their bounds, which is conservative for rotations.
+   */
+  bool mapToLocal(const SkMatrix &matrix, HitTestQuery *result) const {
+    SkMatrix inverse;
+    if (!matrix.invert(&inverse)) {
+      return false;
+    }
+    if (_isPoint) {
+      auto point = inverse.mapXY(_rect.x(), _rect.y());
+      *result = MakePoint(point.x(), point.y());
+    } else {
+      *result = MakeRect(inverse.mapRect(_rect));
+    }
+    return true;
+  }
+
+private:
+  HitTestQuery(const SkRect &rect, bool isPoint)
+      : _rect(rect), _isPoint(isPoint) {}
+
+  SkRect _rect;
+  bool _isPoint;
+};
+
+/**
+ Uniform grid over the bounds of the children of a node, used to find the
+ children that can be hit by a query without testing all of them. Children
+ with unknown bounds are returned for all queries. Children can be moved to
+ the cells of their new bounds without building the whole grid again.
+ */
+class HitTestGrid {
+public:
+  /**
+   Builds the grid from the bounds of the children, in the order they are
+   drawn. Pass nullptr for children with unknown bounds.
+   */
+  void build(const std::vector<const SkRect *> &bounds) {
+    _cells.clear();
+    _unbounded.clear();
+    _entries.clear();
+    _bounds.setEmpty();
+    for (auto rect : bounds) {
+      if (rect != nullptr) {
+        _bounds.join(*rect);
+      }
+    }
+
+    _size = std::clamp(
+        static_cast<int>(std::ceil(std::sqrt(bounds.size() / 2.0))), 1,
+        MaxSize);
+    _cells.resize(_size * _size);
+    _entries.resize(bounds.size());
+    for (size_t i = 0; i < bounds.size(); i++) {
+      insert(i, bounds[i]);
+    }
+    _isValid = true;
+  }
+
+  /**
+   Moves the child at index to the cells of its new bounds. Returns false when
+   the new bounds are outside of the grid, which then needs to be built again.
+   */
+  bool update(size_t index, const SkRect *bounds) {
+    if (!_isValid || index >= _entries.size()) {
+      return false;
+    }
+    if (bounds != nullptr && !bounds->isEmpty() &&
+        !_bounds.contains(*bounds)) {
+      return false;
+    }
+    remove(index);
+    insert(index, bounds);
+    return true;
+  }
+
+  void invalidate() { _isValid = false; }
+  bool isValid() const { return _isValid; }
+
+  /**
+   Returns the indices of the children that can be hit by the query, topmost
+   (last drawn) first.
+   */
+  std::vector<size_t> query(const HitTestQuery &query) const {
+    std::vector<size_t> result(_unbounded);
+    if (query.intersects(_bounds)) {
+      int left, top, right, bottom;
+      getCellRange(query.getRect(), &left, &top, &right, &bottom);
+      for (int y = top; y <= bottom; y++) {
+        for (int x = left; x <= right; x++) {
+          auto &cell = _cells[y * _size + x];
+          result.insert(result.end(), cell.begin(), cell.end());
+        }
+      }
+    }
+    std::sort(result.begin(), result.end(), std::greater<size_t>());
+    result.erase(std::unique(result.begin(), result.end()), result.end());
+    return result;
+  }
+
+private:
+  struct Entry {
+    SkRect bounds = SkRect::MakeEmpty();
+    bool isBounded = false;
+  };
+
+  void insert(size_t index, const SkRect *bounds) {
+    auto &entry = _entries[index];
+    entry.isBounded = bounds != nullptr;
+    entry.bounds = bounds != nullptr ? *bounds : SkRect::MakeEmpty();
+    if (!entry.isBounded) {
+      _unbounded.push_back(index);
+      return;
+    }
+    if (entry.bounds.isEmpty()) {
+      return;
+    }
+    forEachCell(entry.bounds,
+                [index](std::vector<size_t> &cell) { cell.push_back(index); });
+  }
+
+  void remove(size_t index) {
+    auto &entry = _entries[index];
+    if (!entry.isBounded) {
+      _unbounded.erase(
+          std::remove(_unbounded.begin(), _unbounded.end(), index),
+          _unbounded.end());
+      return;
+    }
+    if (entry.bounds.isEmpty()) {
+      return;
+    }
+    forEachCell(entry.bounds, [index](std::vector<size_t> &cell) {
+      cell.erase(std::remove(cell.begin(), cell.end(), index), cell.end());
+    });
+  }
+
+  void forEachCell(const SkRect &rect,
+                   const std::function<void(std::vector<size_t> &)> &fn) {
+    int left, top, right, bottom;
+    getCellRange(rect, &left, &top, &right, &bottom);
+    for (int y = top; y <= bottom; y++) {
+      for (int x = left; x <= right; x++) {
+        fn(_cells[y * _size + x]);
+      }
+    }
+  }
+
+  void getCellRange(const SkRect &rect, int *left, int *top, int *right,
+                    int *bottom) const {
+    auto cellWidth = _bounds.width() / _size;
+    auto cellHeight = _bounds.height() / _size;
+    auto toCell = [this](SkScalar value, SkScalar origin, SkScalar cellSize) {
+      if (cellSize <= 0) {
+        return 0;
+      }
+      auto cell = std::clamp((value - origin) / cellSize, 0.0f,
+                             static_cast<SkScalar>(_size - 1));
+      return static_cast<int>(cell);
+    };
+    *left = toCell(rect.left(), _bounds.left(), cellWidth);
+    *right = toCell(rect.right(), _bounds.left(), cellWidth);
+    *top = toCell(rect.top(), _bounds.top(), cellHeight);
+    *bottom = toCell(rect.bottom(), _bounds.top(), cellHeight);
+  }
+
+  static constexpr int MaxSize = 64;
+
+  std::vector<std::vector<size_t>> _cells;
+  std::vector<size_t> _unbounded;
+  std::vector<Entry> _entries;
+  SkRect _bounds = SkRect::MakeEmpty();
+  int _size = 1;
+  bool _isValid = false;
+};
+
+} // namespace RNSkia
@@ -4,6 +4,15 @@
 #include "JsiPaintNode.h"
 
 #include <memory>
+#include <vector>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkPath.h"
+#include "SkPathUtils.h"
+
+#pragma clang diagnostic pop
 
 namespace RNSkia {
 
@@ -24,39 +33,78 @@ protected:
    */
   virtual void draw(DrawingContext *context) = 0;
 
+  /**
+   Override to return conservative bounds of the geometry drawn by the node in
+   local coordinates, without the paint applied. This is called before drawing
+   whenever the node's properties have changed and the result is cached until
+   the next change. Returning false disables culling for the node.
+   */
+  virtual bool computeBounds(SkRect *bounds) { return false; }
+
+  /**
+   Override to return the exact geometry drawn by the node, in local
+   coordinates, for hit testing. Nodes returning false are hit tested against
+   their bounds.
+   */
+  virtual bool getGeometryPath(SkPath *path) { return false; }
+
   void renderNode(DrawingContext *context) override {
 #if SKIA_DOM_DEBUG
     printDebugInfo("Begin Draw", 1);
 #endif
-    // Save paint if the paint property is set
+    if (!_geometryBounds.isComputed || getPropsContainer()->isChanged()) {
+      _geometryBounds.isKnown = computeBounds(&_geometryBounds.rect);
+      _geometryBounds.isComputed = true;
+    }
+
+    auto drawingContext = context;
     if (_paintProp->isSet()) {
-      auto localCtx = _paintProp->getUnsafeDerivedValue().get();
-      localCtx->setCanvas(context->getCanvas());
-      draw(localCtx);
-    } else {
-      // Call abstract draw method
-      draw(context);
+      drawingContext = _paintProp->getUnsafeDerivedValue().get();
+      drawingContext->setCanvas(context->getCanvas());
+    }
+    _hitTestPaint = drawingContext->getPaint();
+
+    auto hasPaintChildren = !_paintChildren.empty();
+
+    // Compute the bounds with the paint applied and skip drawing if they are
+    // outside of the canvas clip.
+    _hasLocalBounds = false;
+    if (_geometryBounds.isKnown && !hasPaintChildren) {
+      auto paint = drawingContext->getPaint();
+      if (paint->canComputeFastBounds()) {
+        SkRect storage;
+        auto bounds = paint->computeFastBounds(_geometryBounds.rect, &storage);
+        // A paint passed as a property can be mutated from JS without the
+        // node knowing, so only the paint from the context is safe to cache.
+        _localBounds = bounds;
+        _hasLocalBounds = !_paintProp->isSet();
+        if (context->getCanvas()->quickReject(bounds)) {
+#if SKIA_DOM_DEBUG
+          printDebugInfo("Culled", 1);
+#endif
+          return;
+        }
+      }
     }
 
+    // Call abstract draw method
+    draw(drawingContext);
+
     // Draw once more for each child paint node
     auto declarationCtx = context->getDeclarationContext();
-    for (auto &child : getChildren()) {
-      if (child->getNodeClass() == NodeClass::DeclarationNode &&
-          std::static_pointer_cast<JsiDomDeclarationNode>(child)
-                  ->getDeclarationType() == DeclarationType::Paint) {
-        auto paintNode = std::static_pointer_cast<JsiPaintNode>(child);
-        // Draw once again with the paint
+    for (auto &paintChild : _paintChildren) {
+      // The drawing context is kept until the paint node changes
+      if (paintChild.context == nullptr ||
+          paintChild.node->hasSubtreeChanges()) {
         declarationCtx->save();
-        paintNode->decorate(declarationCtx);
+        paintChild.node->decorate(declarationCtx);
         auto paint = declarationCtx->getPaints()->pop();
         declarationCtx->restore();
 
-        // FIXME: Can we avoid creating a new drawing context here each time?
-        auto localContext =
-            std::make_shared<DrawingContext>(std::shared_ptr<SkPaint>(paint));
-        localContext->setCanvas(context->getCanvas());
-        draw(localContext.get());
+        paintChild.context = std::make_shared<DrawingContext>(paint);
       }
+      paintChild.context->setCanvas(context->getCanvas());
+      draw(paintChild.context.get());
     }
 
 #if SKIA_DOM_DEBUG
@@ -64,8 +112,76 @@ protected:
 #endif
   }
 
+  bool getLocalBounds(SkRect *bounds) override {
+    if (!_hasLocalBounds) {
+      return false;
+    }
+    *bounds = _localBounds;
+    return true;
+  }
+
+  /**
+   Hit tests the geometry of the node with the paint it was last drawn with.
+   Nodes that can't compute their bounds are never hit.
+   */
+  void hitTestNode(const HitTestQuery &query,
+                   std::vector<size_t> *result) override {
+    if (!_geometryBounds.isKnown || _hitTestPaint == nullptr) {
+      return;
+    }
+
+    auto hit = false;
+    SkPath path;
+    if (query.isPoint() && getGeometryPath(&path)) {
+      // Strokes and path effects are applied to get the filled outline
+      SkPath fillPath;
+      if (skpathutils::FillPathWithPaint(path, *_hitTestPaint, &fillPath)) {
+        path.swap(fillPath);
+      }
+      hit = path.contains(query.getPoint().x(), query.getPoint().y());
+    } else {
+      SkRect storage;
+      hit = query.intersects(
+          _hitTestPaint->canComputeFastBounds()
+              ? _hitTestPaint->computeFastBounds(_geometryBounds.rect,
+                                                 &storage)
+              : _geometryBounds.rect);
+    }
+
+    if (hit) {
+      result->push_back(getNodeId());
+    }
+  }
+
+  void onChildrenChanged() override {
+    JsiDomRenderNode::onChildrenChanged();
+    _paintChildren.clear();
+    for (auto child : getDeclarationChildren()) {
+      auto declarationNode = static_cast<JsiDomDeclarationNode *>(child);
+      if (declarationNode->getDeclarationType() == DeclarationType::Paint) {
+        _paintChildren.push_back({declarationNode, nullptr});
+      }
+    }
+  }
+
 private:
+  struct PaintChild {
+    JsiDomDeclarationNode *node;
+    std::shared_ptr<DrawingContext> context;
+  };
+
+  struct GeometryBounds {
+    SkRect rect;
+    bool isKnown = false;
+    bool isComputed = false;
+  };
+
   PaintDrawingContextProp *_paintProp;
+  std::vector<PaintChild> _paintChildren;
+  GeometryBounds _geometryBounds;
+  std::shared_ptr<SkPaint> _hitTestPaint;
+  SkRect _localBounds;
+  bool _hasLocalBounds = false;
 };
 
 } // namespace RNSkia
@@ -172,7 +172,14 @@ public:
     return jsi::String::createFromUtf8(runtime, getType());
   }
 
-  JSI_EXPORT_PROPERTY_GETTERS(JSI_EXPORT_PROP_GET(JsiDomNode, type))
+  /**
+   JS Property for getting the identifier of the node, which is what hit
+   testing returns.
+   */
+  JSI_PROPERTY_GET(nodeId) { return static_cast<double>(getNodeId()); }
+
+  JSI_EXPORT_PROPERTY_GETTERS(JSI_EXPORT_PROP_GET(JsiDomNode, type),
+                              JSI_EXPORT_PROP_GET(JsiDomNode, nodeId))
 
   JSI_EXPORT_FUNCTIONS(JSI_EXPORT_FUNC(JsiDomNode, setProps),
                        JSI_EXPORT_FUNC(JsiDomNode, setProp),
@@ -223,17 +230,24 @@ public:
    function will swap any pending property changes in this and children with any
    waiting values that has been set by the javascript thread. Props will also be
    marked as changed so that we can calculate wether updates are required or
-   not.
+   not. The context is the one of the view that renders the nodes next.
    */
-  void commitPendingChanges() {
+  void commitPendingChanges(DomRenderContext *context) {
     // Update properties container
     if (_propsContainer != nullptr) {
       _propsContainer->updatePendingValues();
     }
+    _hasSubtreeChanges =
+        _propsContainer != nullptr && _propsContainer->isChanged();
+    if (_hasSubtreeChanges) {
+      onPropertiesCommitted(context);
+    }
 
     // Run all pending node operations
+    auto hasNodeOps = false;
     {
       std::lock_guard<std::mutex> lock(_childrenLock);
+      hasNodeOps = !_queuedNodeOps.empty();
       for (auto &op : _queuedNodeOps) {
         op();
       }
@@ -241,12 +255,53 @@ public:
       _queuedNodeOps.clear();
     }
 
-    // Update children
+    if (hasNodeOps) {
+      onChildrenChanged();
+    }
+
+    // Update children, their changes and volatility are propagated up so that
+    // ancestors don't need to visit them again
+    _hasChildChanges = hasNodeOps;
+    _hasVolatileDescendants = false;
     for (auto &child : _children) {
-      child->commitPendingChanges();
+      child->commitPendingChanges(context);
+      if (child->hasSubtreeChanges()) {
+        _hasChildChanges = true;
+      }
+      if (child->isVolatile() || child->hasVolatileDescendants()) {
+        _hasVolatileDescendants = true;
+      }
+    }
+    if (_hasChildChanges) {
+      _hasSubtreeChanges = true;
     }
   }
 
+  /**
+   Returns true if the last call to commitPendingChanges changed properties or
+   children of this node or any of its descendants.
+   */
+  bool hasSubtreeChanges() { return _hasSubtreeChanges; }
+
+  /**
+   Returns true if the last call to commitPendingChanges added or removed
+   children, or changed any of the descendants of this node.
+   */
+  bool hasChildChanges() { return _hasChildChanges; }
+
+  /**
+   Override to return true when what the node draws can change without any of
+   its props changing, for instance when it is drawn by a JS callback. Such
+   nodes are never cached by their ancestors.
+   */
+  virtual bool isVolatile() { return false; }
+
+  /**
+   Returns true if any of the descendants of this node was volatile in the
+   last call to commitPendingChanges.
+   */
+  bool hasVolatileDescendants() { return _hasVolatileDescendants; }
+
   /**
    When pending properties has been updated and all rendering is done, we call
    this function to mark any changes as processed. This call also resolves all
@@ -257,6 +312,8 @@ public:
     if (_propsContainer != nullptr) {
       _propsContainer->markAsResolved();
     }
+    _hasSubtreeChanges = false;
+    _hasChildChanges = false;
 
     // Now let's invalidate if needed
     if (_isDisposing && !_isDisposed) {
@@ -359,6 +416,19 @@ protected:
    */
   virtual void onPropertyChanged(BaseNodeProp *prop) {}
 
+  /**
+   Override to be notified when changed properties have been committed, even
+   if the node is not rendered afterwards because it is culled.
+   */
+  virtual void onPropertiesCommitted(DomRenderContext *context) {}
+
+  /**
+   Override to be notified when children have been added or removed. This is
+   called before rendering, and is where nodes should classify their children
+   so that rendering doesn't need to.
+   */
+  virtual void onChildrenChanged() {}
+
   /**
    Adds a child node to the array of children for this node
    */
@@ -423,6 +493,7 @@ protected:
 
     if (_isDisposing) {
       removeChild(false);
+      onChildrenChanged();
     } else {
       enqueAsynOperation(removeChild);
     }
@@ -543,6 +614,9 @@ private:
 
   std::atomic<bool> _isDisposing = {false};
   bool _isDisposed = false;
+  bool _hasSubtreeChanges = true;
+  bool _hasChildChanges = true;
+  bool _hasVolatileDescendants = false;
 
   size_t _nodeId;
 
@@ -3,6 +3,7 @@
 
 #include "ClipProp.h"
 #include "DrawingContext.h"
+#include "HitTest.h"
 #include "JsiDomDeclarationNode.h"
 #include "JsiDomNode.h"
 #include "LayerProp.h"
@@ -13,10 +14,18 @@
 #include "RectProp.h"
 #include "TransformProp.h"
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
 
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkData.h"
+
+#pragma clang diagnostic pop
+
 namespace RNSkia {
 
 class JsiDomRenderNode : public JsiDomNode {
@@ -31,11 +40,38 @@ public:
 #endif
 
     auto parentPaint = context->getPaint();
-    auto cache =
-        _paintCache.parent == parentPaint ? _paintCache.child : nullptr;
 
-    auto shouldRestore =
-        context->saveAndConcat(_paintProps, getChildren(), cache);
+    std::chrono::steady_clock::time_point captureStart;
+    if (context->isCapturing()) {
+      captureStart = std::chrono::steady_clock::now();
+      _captureInfo = {context->getCaptureId(), 0, false};
+    }
+
+    // Skip the node if nothing in it changed since it was last rendered with
+    // the same paint and its bounds are outside of the canvas clip.
+    if (!hasSubtreeChanges() && _bounds.isValid &&
+        _bounds.parent == parentPaint &&
+        context->getCanvas()->quickReject(_bounds.rect)) {
+#if SKIA_DOM_DEBUG
+      printDebugInfo("Culled");
+#endif
+      _captureInfo.isCulled = true;
+      return;
+    }
+
+    if (context->isCapturing()) {
+      beginCaptureMarker(context->getCanvas());
+    }
+
+    // Nodes that don't change the paint are also cached, so that the paint
+    // is only resolved again when the node or its declarations change.
+    auto isCached = _paintCache.parent == parentPaint;
+    auto shouldRestore = false;
+    if (!isCached || _paintCache.child != nullptr) {
+      shouldRestore = context->saveAndConcat(
+          _paintProps, _declarationChildren,
+          isCached ? _paintCache.child : nullptr);
+    }
 
     auto shouldTransform = _matrixProp->isSet() || _transformProp->isSet();
     auto shouldSave =
@@ -106,6 +142,7 @@ public:
 
     // Render the node
     renderNode(context);
+    updateBounds(parentPaint);
 
     // Restore if needed
     if (shouldSave) {
@@ -115,10 +152,20 @@ public:
       context->getCanvas()->restore();
     }
 
+    _paintCache.parent = parentPaint;
     if (shouldRestore) {
-      _paintCache.parent = parentPaint;
       _paintCache.child = context->getPaint();
       context->restore();
+    } else {
+      _paintCache.child = nullptr;
+    }
+
+    if (context->isCapturing()) {
+      endCaptureMarker(context->getCanvas());
+      _captureInfo.renderTime =
+          std::chrono::duration<double, std::micro>(
+              std::chrono::steady_clock::now() - captureStart)
+              .count();
     }
 
 #if SKIA_DOM_DEBUG
@@ -138,6 +185,89 @@ public:
   void dispose(bool immediate) override {
     JsiDomNode::dispose(immediate);
     _paintCache.clear();
+    _bounds.clear();
+  }
+
+  /**
+   Returns the bounds of what the node drew the last time it was rendered, in
+   the coordinate space of its parent. Returns false if the bounds are not
+   known.
+   */
+  bool getBounds(SkRect *bounds) {
+    if (!_bounds.isValid) {
+      return false;
+    }
+    *bounds = _bounds.rect;
+    return true;
+  }
+
+  /**
+   Returns the render node children, in drawing order. The list is updated
+   when children are added or removed.
+   */
+  const std::vector<JsiDomRenderNode *> &getRenderChildren() {
+    return _renderChildren;
+  }
+
+  /**
+   Information about how the node was rendered in a captured frame.
+   */
+  struct CaptureInfo {
+    size_t captureId;
+    // Time spent rendering the node and its children, in microseconds
+    double renderTime;
+    bool isCulled;
+  };
+
+  /**
+   Returns the capture information if the node was visited when the frame with
+   the given capture id was rendered.
+   */
+  bool getCaptureInfo(size_t captureId, CaptureInfo *info) {
+    if (_captureInfo.captureId != captureId) {
+      return false;
+    }
+    *info = _captureInfo;
+    return true;
+  }
+
+  /**
+   Annotation keys marking the beginning and end of what a node draws in a
+   captured picture. The value of the annotations is the node id.
+   */
+  static constexpr const char *CaptureBeginKey = "RNSkia/DomNode/begin";
+  static constexpr const char *CaptureEndKey = "RNSkia/DomNode/end";
+
+  /**
+   Collects the ids of the nodes hit by the query, topmost node first. The
+   query is in the coordinate space of the node's parent and is tested against
+   what was drawn the last time the node was rendered.
+   */
+  void hitTest(const HitTestQuery &query, std::vector<size_t> *result) {
+    if (!_bounds.isRendered ||
+        (_bounds.isValid && !query.intersects(_bounds.rect))) {
+      return;
+    }
+
+    SkMatrix matrix;
+    SkMatrix clipMatrix;
+    getLocalMatrix(&matrix, &clipMatrix);
+    auto localQuery = query;
+    if (!query.mapToLocal(matrix, &localQuery)) {
+      return;
+    }
+
+    // Bounds are only intersected with the bounds of the clip, so points are
+    // tested against the exact clip as well.
+    if (_clipProp->isSet() && query.isPoint()) {
+      auto clipQuery = query;
+      if (!query.mapToLocal(clipMatrix, &clipQuery) ||
+          !isInClip(clipQuery.getPoint())) {
+        return;
+      }
+    }
+
+    hitTestNode(localQuery, result);
   }
 
 protected:
@@ -162,6 +292,64 @@ protected:
    */
   virtual void renderNode(DrawingContext *context) = 0;
 
+  /**
+   Override to return conservative bounds, in the local coordinate space of the
+   node, of everything drawn by the last call to renderNode. Returning false
+   means that the bounds are unknown, and the node will not be culled.
+   */
+  virtual bool getLocalBounds(SkRect *bounds) { return false; }
+
+  /**
+   Override to add the ids of the nodes hit by the query, which is in the
+   local coordinate space of the node. The default implementation tests the
+   local bounds of the node.
+   */
+  virtual void hitTestNode(const HitTestQuery &query,
+                           std::vector<size_t> *result) {
+    SkRect bounds;
+    if (getLocalBounds(&bounds) && query.intersects(bounds)) {
+      result->push_back(getNodeId());
+    }
+  }
+
+  /**
+   Hit tests the render node children, topmost first.
+   */
+  void hitTestChildren(const HitTestQuery &query,
+                       std::vector<size_t> *result) {
+    auto &children = getChildren();
+    for (auto it = children.rbegin(); it != children.rend(); ++it) {
+      if ((*it)->getNodeClass() == NodeClass::RenderNode) {
+        std::static_pointer_cast<JsiDomRenderNode>(*it)->hitTest(query,
+                                                                 result);
+      }
+    }
+  }
+
+  /**
+   Classifies the children into render and declaration children.
+   */
+  void onChildrenChanged() override {
+    _renderChildren.clear();
+    _declarationChildren.clear();
+    for (auto &child : getChildren()) {
+      if (child->getNodeClass() == NodeClass::RenderNode) {
+        _renderChildren.push_back(
+            static_cast<JsiDomRenderNode *>(child.get()));
+      } else {
+        _declarationChildren.push_back(child.get());
+      }
+    }
+    _paintCache.clear();
+  }
+
+  /**
+   Returns the declaration node children
+   */
+  const std::vector<JsiDomNode *> &getDeclarationChildren() {
+    return _declarationChildren;
+  }
+
   /**
    Define common properties for all render nodes
    */
@@ -239,6 +427,112 @@ private:
     }
   }
 
+  void beginCaptureMarker(SkCanvas *canvas) {
+    auto id = SkData::MakeWithCString(std::to_string(getNodeId()).c_str());
+    canvas->drawAnnotation(canvas->getLocalClipBounds(), CaptureBeginKey,
+                           id.get());
+  }
+
+  void endCaptureMarker(SkCanvas *canvas) {
+    auto id = SkData::MakeWithCString(std::to_string(getNodeId()).c_str());
+    canvas->drawAnnotation(canvas->getLocalClipBounds(), CaptureEndKey,
+                           id.get());
+  }
+
+  /**
+   Returns the matrix from the local coordinate space of the node to its
+   parent's, and the matrix the clip is applied with.
+   */
+  void getLocalMatrix(SkMatrix *matrix, SkMatrix *clipMatrix) {
+    matrix->reset();
+    if (_originProp->isSet()) {
+      matrix->setTranslate(_originProp->getDerivedValue()->x(),
+                           _originProp->getDerivedValue()->y());
+    }
+    if (_matrixProp->isSet() || _transformProp->isSet()) {
+      matrix->preConcat(_matrixProp->isSet()
+                            ? *_matrixProp->getDerivedValue()
+                            : *_transformProp->getDerivedValue());
+    }
+    // The clip is applied before the origin translation is reverted
+    *clipMatrix = *matrix;
+    if (_originProp->isSet()) {
+      matrix->preTranslate(-_originProp->getDerivedValue()->x(),
+                           -_originProp->getDerivedValue()->y());
+    }
+  }
+
+  /**
+   Returns true if the point, in the coordinate space of the clip, is inside
+   the clip of the node.
+   */
+  bool isInClip(const SkPoint &point) {
+    auto contains = true;
+    if (_clipProp->getRect() != nullptr) {
+      contains = _clipProp->getRect()->contains(point.x(), point.y());
+    } else if (_clipProp->getRRect() != nullptr) {
+      SkPath path;
+      path.addRRect(*_clipProp->getRRect());
+      contains = path.contains(point.x(), point.y());
+    } else if (_clipProp->getPath() != nullptr) {
+      contains = _clipProp->getPath()->contains(point.x(), point.y());
+    }
+    auto invert = _invertClip->isSet() && _invertClip->value().getAsBool();
+    return invert ? !contains : contains;
+  }
+
+  /**
+   Updates the cached bounds of the node in its parent's coordinate space after
+   rendering, applying the node's own transform and clip.
+   */
+  void updateBounds(std::shared_ptr<SkPaint> parentPaint) {
+    _bounds.parent = parentPaint;
+    _bounds.isValid = false;
+    _bounds.isRendered = true;
+
+    SkRect bounds;
+    // A layer paint can move pixels outside of what the children draw
+    if ((_layerProp->isSet() && !_layerProp->isBool()) ||
+        !getLocalBounds(&bounds)) {
+      return;
+    }
+
+    SkMatrix matrix;
+    SkMatrix clipMatrix;
+    getLocalMatrix(&matrix, &clipMatrix);
+    bounds = matrix.mapRect(bounds);
+
+    auto invert = _invertClip->isSet() && _invertClip->value().getAsBool();
+    if (_clipProp->isSet() && !invert) {
+      SkRect clipBounds = SkRect::MakeEmpty();
+      if (_clipProp->getRect() != nullptr) {
+        clipBounds = *_clipProp->getRect();
+      } else if (_clipProp->getRRect() != nullptr) {
+        clipBounds = _clipProp->getRRect()->rect();
+      } else if (_clipProp->getPath() != nullptr) {
+        clipBounds = _clipProp->getPath()->getBounds();
+      }
+      if (!bounds.intersect(clipMatrix.mapRect(clipBounds))) {
+        bounds.setEmpty();
+      }
+    }
+
+    _bounds.rect = bounds;
+    _bounds.isValid = true;
+  }
+
+  struct BoundsCache {
+    void clear() {
+      parent = nullptr;
+      isValid = false;
+      isRendered = false;
+    }
+    std::shared_ptr<SkPaint> parent;
+    SkRect rect;
+    bool isValid = false;
+    bool isRendered = false;
+  };
+
   struct PaintCache {
     void clear() {
       parent = nullptr;
@@ -249,6 +543,10 @@ private:
   };
 
   PaintCache _paintCache;
+  BoundsCache _bounds;
+  std::vector<JsiDomRenderNode *> _renderChildren;
+  std::vector<JsiDomNode *> _declarationChildren;
+  CaptureInfo _captureInfo = {0, 0, false};
 
   PointProp *_originProp;
   MatrixProp *_matrixProp;
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "DrawingContext.h"
+#include "JsiDomRenderNode.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkCanvas.h"
+#include "SkM44.h"
+#include "SkPicture.h"
+#include "SkPictureRecorder.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+/**
+ Records render nodes into separate pictures on several threads. Every thread
+ taking part calls run(), which records nodes until there are none left, so
+ the recording finishes even if no other thread gets to help. The pictures
+ are recorded in device space with the matrix of the canvas they will be
+ drawn to, so that nodes are culled and rasterize cached content exactly as
+ if they were rendered directly.
+ */
+class ParallelRecorder {
+public:
+  ParallelRecorder(const SkM44 &matrix, const SkRect &cullRect)
+      : _matrix(matrix), _cullRect(cullRect) {}
+
+  /**
+   Adds a node to record. The node must not share mutable state with the
+   other nodes, and is rendered with its own drawing context.
+   */
+  void addNode(JsiDomRenderNode *node,
+               std::shared_ptr<DrawingContext> context) {
+    _tasks.push_back({node, std::move(context), nullptr, nullptr});
+  }
+
+  size_t getNodeCount() { return _tasks.size(); }
+
+  /**
+   Records nodes until all nodes have been taken by a thread.
+   */
+  void run() {
+    size_t index;
+    while ((index = _next++) < _tasks.size()) {
+      auto &task = _tasks[index];
+      try {
+        SkPictureRecorder recorder;
+        auto canvas = recorder.beginRecording(_cullRect);
+        canvas->setMatrix(_matrix);
+        task.context->setCanvas(canvas);
+        task.node->render(task.context.get());
+        task.picture = recorder.finishRecordingAsPicture();
+      } catch (...) {
+        task.error = std::current_exception();
+      }
+
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (++_done == _tasks.size()) {
+        _finished.notify_all();
+      }
+    }
+  }
+
+  /**
+   Waits until all nodes have been recorded.
+   */
+  void wait() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _finished.wait(lock, [this] { return _done == _tasks.size(); });
+  }
+
+  JsiDomRenderNode *getNode(size_t index) { return _tasks[index].node; }
+
+  /**
+   Draws the picture recorded for the node with the given index, or rethrows
+   the error raised while recording it.
+   */
+  void draw(size_t index, SkCanvas *canvas) {
+    auto &task = _tasks[index];
+    if (task.error != nullptr) {
+      std::rethrow_exception(task.error);
+    }
+    canvas->save();
+    canvas->resetMatrix();
+    canvas->drawPicture(task.picture);
+    canvas->restore();
+  }
+
+private:
+  struct Task {
+    JsiDomRenderNode *node;
+    std::shared_ptr<DrawingContext> context;
+    sk_sp<SkPicture> picture;
+    std::exception_ptr error;
+  };
+
+  SkM44 _matrix;
+  SkRect _cullRect;
+  std::vector<Task> _tasks;
+  std::atomic<size_t> _next = {0};
+  size_t _done = 0;
+  std::mutex _mutex;
+  std::condition_variable _finished;
+};
+
+} // namespace RNSkia
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkCanvas.h"
+#include "SkImage.h"
+#include "SkSurface.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+/**
+ Cache for rasterized shadows. Blurring is one of the most expensive things we
+ draw, and the result only depends on the shape, the blur, the color and the
+ scale it is drawn with - not on where it is drawn. Identical shadows (like the
+ shadows of cards in a list) are therefore blurred once into an image that is
+ reused across nodes and frames, which also lets Skia reuse the uploaded
+ texture on the GPU.
+
+ An image is only rasterized the second time a key is requested. Shadows that
+ change every frame (when animated) are drawn directly instead of filling the
+ cache with images that are never reused. Entries are evicted in least
+ recently used order when the memory budget is exceeded.
+ */
+class ShadowCache {
+public:
+  /**
+   Identifies a rasterized shadow. Geometry must be relative to the shape
+   being shadowed so that equal shadows at different positions share images.
+   */
+  struct Key {
+    std::array<SkScalar, 16> values;
+    SkColor color;
+
+    bool operator==(const Key &other) const {
+      return color == other.color && values == other.values;
+    }
+  };
+
+  static ShadowCache &getInstance() {
+    static ShadowCache instance;
+    return instance;
+  }
+
+  /**
+   Returns an image with the shadow rasterized by the draw function, which is
+   called with a canvas where the given bounds are visible at the given scale.
+   Returns nullptr when the shadow should be drawn directly.
+   */
+  template <typename DrawFn>
+  sk_sp<SkImage> getImage(const Key &key, const SkRect &bounds, SkScalar scale,
+                          const DrawFn &draw) {
+    auto width = static_cast<int>(std::ceil(bounds.width() * scale));
+    auto height = static_cast<int>(std::ceil(bounds.height() * scale));
+    auto bytes = static_cast<size_t>(width) * height * 4;
+    if (width <= 0 || height <= 0 || bytes > MaxImageBytes) {
+      return nullptr;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      auto it = _entries.find(key);
+      if (it == _entries.end()) {
+        // First request, remember the key but draw directly
+        _lru.push_front(key);
+        _entries.emplace(key, Entry{nullptr, 0, _lru.begin()});
+        evict();
+        return nullptr;
+      }
+      _lru.splice(_lru.begin(), _lru, it->second.position);
+      if (it->second.image != nullptr) {
+        return it->second.image;
+      }
+    }
+
+    // Rasterize without holding the lock, blurring can take a while and
+    // shadows are drawn from several threads
+    auto surface = SkSurface::MakeRasterN32Premul(width, height);
+    if (surface == nullptr) {
+      return nullptr;
+    }
+    auto canvas = surface->getCanvas();
+    canvas->scale(scale, scale);
+    canvas->translate(-bounds.left(), -bounds.top());
+    draw(canvas);
+    auto image = surface->makeImageSnapshot();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _entries.find(key);
+    if (it == _entries.end()) {
+      // Evicted in the meantime
+      return image;
+    }
+    if (it->second.image != nullptr) {
+      // Rasterized by another thread in the meantime
+      return it->second.image;
+    }
+    it->second.image = image;
+    it->second.bytes = bytes;
+    _totalBytes += bytes;
+    evict();
+    return image;
+  }
+
+private:
+  struct KeyHash {
+    size_t operator()(const Key &key) const {
+      size_t hash = std::hash<SkColor>()(key.color);
+      for (auto value : key.values) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        hash = hash * 31 + std::hash<uint32_t>()(bits);
+      }
+      return hash;
+    }
+  };
+
+  struct Entry {
+    sk_sp<SkImage> image;
+    size_t bytes;
+    std::list<Key>::iterator position;
+  };
+
+  void evict() {
+    while ((_totalBytes > MaxTotalBytes || _entries.size() > MaxEntries) &&
+           _lru.size() > 1) {
+      auto it = _entries.find(_lru.back());
+      _totalBytes -= it->second.bytes;
+      _entries.erase(it);
+      _lru.pop_back();
+    }
+  }
+
+  static constexpr size_t MaxTotalBytes = 32 * 1024 * 1024;
+  static constexpr size_t MaxImageBytes = MaxTotalBytes / 8;
+  static constexpr size_t MaxEntries = 1024;
+
+  std::unordered_map<Key, Entry, KeyHash> _entries;
+  std::list<Key> _lru;
+  size_t _totalBytes = 0;
+  std::mutex _mutex;
+};
+
+} // namespace RNSkia
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "AtlasProps.h"
+#include "BlendModeProp.h"
+#include "JsiDomDrawingNode.h"
+
+#include <memory>
+
+namespace RNSkia {
+
+class JsiAtlasNode : public JsiDomDrawingNode,
+                     public JsiDomNodeCtor<JsiAtlasNode> {
+public:
+  explicit JsiAtlasNode(std::shared_ptr<RNSkPlatformContext> context)
+      : JsiDomDrawingNode(context, "skAtlas") {}
+
+protected:
+  bool computeBounds(SkRect *bounds) override {
+    auto sprites = _atlasProps->getDerivedValue();
+    if (sprites == nullptr) {
+      return false;
+    }
+    *bounds = sprites->bounds;
+    return true;
+  }
+
+  void draw(DrawingContext *context) override {
+    auto image = _atlasProps->getImage();
+    auto sprites = _atlasProps->getDerivedValue();
+    if (image == nullptr || sprites == nullptr) {
+      return;
+    }
+    auto hasColors = !sprites->colors.empty();
+    SkBlendMode defaultBlendMode =
+        hasColors ? SkBlendMode::kDstOver : SkBlendMode::kSrcOver;
+    context->getCanvas()->drawAtlas(
+        image.get(), sprites->transforms.data(), sprites->rects.data(),
+        hasColors ? sprites->colors.data() : nullptr,
+        static_cast<int>(sprites->rects.size()),
+        _blendModeProp->isSet() ? *_blendModeProp->getDerivedValue()
+                                : defaultBlendMode,
+        SkSamplingOptions(), &sprites->bounds, context->getPaint().get());
+  }
+
+  void defineProperties(NodePropsContainer *container) override {
+    JsiDomDrawingNode::defineProperties(container);
+    _atlasProps = container->defineProperty<AtlasProps>();
+    _blendModeProp = container->defineProperty<BlendModeProp>("blendMode");
+  }
+
+private:
+  AtlasProps *_atlasProps;
+  BlendModeProp *_blendModeProp;
+};
+
+} // namespace RNSkia
@@ -15,14 +15,14 @@ public:
 
 protected:
   void draw(DrawingContext *context) override {
-    auto children = getChildren();
+    auto &children = getChildren();
 
     if (children.size() == 0) {
       return;
     }
 
     auto canvas = context->getCanvas();
-    auto firstChild = children[0];
+    auto &firstChild = children[0];
     sk_sp<SkImageFilter> imageFilter;
 
     if (firstChild->getNodeClass() == NodeClass::DeclarationNode) {
@@ -2,7 +2,10 @@
 
 #include "JsiBoxShadowNode.h"
 #include "JsiDomRenderNode.h"
+#include "ShadowCache.h"
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <vector>
 
@@ -18,51 +21,61 @@ protected:
     // Get rect - we'll try to end up with an rrect:
     auto box = *_boxProp->getDerivedValue();
 
-    // Get shadows
-    std::vector<std::shared_ptr<JsiBoxShadowNode>> shadows;
-    for (auto &child : getChildren()) {
-      auto shadowNode = std::dynamic_pointer_cast<JsiBoxShadowNode>(child);
-      if (shadowNode != nullptr && shadowNode->getBoxShadowProps()->isSet()) {
-        shadows.push_back(shadowNode);
-      }
+    // The scale is needed to rasterize cached shadows at device resolution,
+    // shadows drawn with rotations or perspective are never cached.
+    auto canvas = context->getCanvas();
+    auto matrix = canvas->getTotalMatrix();
+    SkScalar scale = 0;
+    if (matrix.isScaleTranslate()) {
+      scale = std::max(std::abs(matrix.getScaleX()),
+                       std::abs(matrix.getScaleY()));
+      // Quantize to avoid a new image for each step of a scale animation
+      scale = std::ceil(scale * 4) / 4;
     }
+
     // Render outer shadows
-    for (auto &shadow : shadows) {
-      if (!shadow->getBoxShadowProps()->isInner()) {
+    for (auto shadow : _shadows) {
+      auto props = shadow->getBoxShadowProps();
+      if (props->isSet() && !props->isInner()) {
         // Now let's render
-        auto dx = shadow->getBoxShadowProps()->getDx();
-        auto dy = shadow->getBoxShadowProps()->getDy();
-        auto spread = shadow->getBoxShadowProps()->getSpread();
-
-        context->getCanvas()->drawRRect(
-            inflate(box, spread, spread, dx, dy),
-            *shadow->getBoxShadowProps()->getDerivedValue());
+        auto dx = props->getDx();
+        auto dy = props->getDy();
+        auto spread = props->getSpread();
+        auto shadowRRect = inflate(box, spread, spread, dx, dy);
+        auto paint = props->getDerivedValue();
+
+        SkRect storage;
+        auto bounds = paint->computeFastBounds(shadowRRect.rect(), &storage);
+        drawShadow(canvas, box, props, bounds, scale, [&](SkCanvas *canvas) {
+          canvas->drawRRect(shadowRRect, *paint);
+        });
       }
     }
 
     // Render box
-    context->getCanvas()->drawRRect(box, *context->getPaint());
+    canvas->drawRRect(box, *context->getPaint());
 
     // Render inner shadows
-    for (auto &shadow : shadows) {
-      if (shadow->getBoxShadowProps()->isInner()) {
+    for (auto shadow : _shadows) {
+      auto props = shadow->getBoxShadowProps();
+      if (props->isSet() && props->isInner()) {
         // Now let's render
-        auto dx = shadow->getBoxShadowProps()->getDx();
-        auto dy = shadow->getBoxShadowProps()->getDy();
-        auto spread = shadow->getBoxShadowProps()->getSpread();
+        auto dx = props->getDx();
+        auto dy = props->getDy();
+        auto spread = props->getSpread();
         auto delta = SkPoint::Make(10 + std::abs(dx), 10 + std::abs(dy));
-
-        context->getCanvas()->save();
-        context->getCanvas()->clipRRect(box, SkClipOp::kIntersect, false);
-
         auto inner = deflate(box, spread, spread, dx, dy);
         auto outer = inflate(box, delta.x(), delta.y());
-
-        // Render!
-        context->getCanvas()->drawDRRect(
-            outer, inner, *shadow->getBoxShadowProps()->getDerivedValue());
-
-        context->getCanvas()->restore();
+        auto paint = props->getDerivedValue();
+
+        drawShadow(canvas, box, props, box.rect(), scale,
+                   [&](SkCanvas *canvas) {
+                     canvas->save();
+                     canvas->clipRRect(box, SkClipOp::kIntersect, false);
+                     // Render!
+                     canvas->drawDRRect(outer, inner, *paint);
+                     canvas->restore();
+                   });
       }
     }
   }
@@ -73,7 +86,62 @@ protected:
     _boxProp->require();
   }
 
+  void onChildrenChanged() override {
+    JsiDomRenderNode::onChildrenChanged();
+    _shadows.clear();
+    for (auto child : getDeclarationChildren()) {
+      auto shadowNode = dynamic_cast<JsiBoxShadowNode *>(child);
+      if (shadowNode != nullptr) {
+        _shadows.push_back(shadowNode);
+      }
+    }
+  }
+
 private:
+  /**
+   Draws a shadow covering the given bounds, from the shadow cache when
+   possible. A scale of zero means that the shadow can't be cached.
+   */
+  template <typename DrawFn>
+  void drawShadow(SkCanvas *canvas, const SkRRect &box, BoxShadowProps *props,
+                  const SkRect &bounds, SkScalar scale, const DrawFn &draw) {
+    sk_sp<SkImage> image;
+    if (scale > 0) {
+      // The key is relative to the box origin so that equal boxes share the
+      // image wherever they are drawn.
+      auto rect = box.rect();
+      ShadowCache::Key key;
+      key.values = {props->isInner() ? 1.0f : 0.0f,
+                    rect.width(),
+                    rect.height(),
+                    box.radii(SkRRect::kUpperLeft_Corner).x(),
+                    box.radii(SkRRect::kUpperLeft_Corner).y(),
+                    box.radii(SkRRect::kUpperRight_Corner).x(),
+                    box.radii(SkRRect::kUpperRight_Corner).y(),
+                    box.radii(SkRRect::kLowerRight_Corner).x(),
+                    box.radii(SkRRect::kLowerRight_Corner).y(),
+                    box.radii(SkRRect::kLowerLeft_Corner).x(),
+                    box.radii(SkRRect::kLowerLeft_Corner).y(),
+                    props->getDx(),
+                    props->getDy(),
+                    props->getSpread(),
+                    props->getBlur(),
+                    scale};
+      key.color = props->getColor();
+      image = ShadowCache::getInstance().getImage(key, bounds, scale, draw);
+    }
+
+    if (image == nullptr) {
+      draw(canvas);
+      return;
+    }
+    auto dest = SkRect::MakeXYWH(bounds.x(), bounds.y(),
+                                 image->width() / scale,
+                                 image->height() / scale);
+    canvas->drawImageRect(image, dest, SkSamplingOptions(SkFilterMode::kLinear),
+                          nullptr);
+  }
+
   SkRRect inflate(const SkRRect &box, SkScalar dx, SkScalar dy, SkScalar tx = 0,
                   SkScalar ty = 0) {
     return SkRRect::MakeRectXY(
@@ -89,6 +157,7 @@ private:
   }
 
   BoxProps *_boxProp;
+  std::vector<JsiBoxShadowNode *> _shadows;
 };
 
 } // namespace RNSkia
@@ -14,6 +14,21 @@ public:
       : JsiDomDrawingNode(context, "skCircle") {}
 
 protected:
+  bool computeBounds(SkRect *bounds) override {
+    auto circle = _circleProp->getDerivedValue();
+    auto r = _radiusProp->value().getAsNumber();
+    *bounds = SkRect::MakeLTRB(circle->x() - r, circle->y() - r,
+                               circle->x() + r, circle->y() + r);
+    return true;
+  }
+
+  bool getGeometryPath(SkPath *path) override {
+    auto circle = _circleProp->getDerivedValue();
+    path->addCircle(circle->x(), circle->y(),
+                    _radiusProp->value().getAsNumber());
+    return true;
+  }
+
   void draw(DrawingContext *context) override {
     auto circle = _circleProp->getDerivedValue();
     auto r = _radiusProp->value().getAsNumber();
@@ -18,6 +18,12 @@ public:
   explicit JsiCustomDrawingNode(std::shared_ptr<RNSkPlatformContext> context)
       : JsiDomDrawingNode(context, "skCustomDrawing") {}
 
+  /**
+   The drawing callback runs again every frame and its picture is set
+   asynchronously, without a commit.
+   */
+  bool isVolatile() override { return true; }
+
 protected:
   void draw(DrawingContext *context) override {
     if (_drawing != nullptr) {
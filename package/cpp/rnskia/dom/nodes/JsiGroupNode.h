@@ -2,8 +2,21 @@
 #pragma once
 
 #include "JsiDomRenderNode.h"
+#include "ParallelRecorder.h"
+#include "RNSkBatchingCanvas.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <vector>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkPicture.h"
+#include "SkPictureRecorder.h"
+
+#pragma clang diagnostic pop
 
 namespace RNSkia {
 
@@ -14,12 +27,296 @@ public:
       : JsiDomRenderNode(context, "skGroup") {}
 
   void renderNode(DrawingContext *context) override {
+    // The bounds of a child can only change when something in its subtree
+    // changed, or when all children are drawn with another paint.
+    if (context->getPaint() != _gridPaint) {
+      invalidateGrid();
+      _gridPaint = context->getPaint();
+    } else if (hasSubtreeChanges() && _grid.isValid()) {
+      for (size_t i = 0; i < _gridChildren.size(); i++) {
+        if (_gridChildren[i]->hasSubtreeChanges()) {
+          _gridUpdates.push_back(i);
+        }
+      }
+      // Once most children have moved, building the grid is cheaper
+      if (_gridUpdates.size() > _gridChildren.size() / 2) {
+        compactGridUpdates();
+        if (_gridUpdates.size() > _gridChildren.size() / 2) {
+          invalidateGrid();
+        }
+      }
+    }
+
+    if (!renderFromPicture(context)) {
+      renderChildren(context);
+    }
+  }
+
+  void dispose(bool immediate) override {
+    JsiDomRenderNode::dispose(immediate);
+    invalidateGrid();
+    _gridPaint = nullptr;
+    _picture.clear();
+  }
+
+protected:
+  /**
+   The bounds of a group is the union of the bounds of its children, and are
+   only known when the bounds of all children are known.
+   */
+  bool getLocalBounds(SkRect *bounds) override {
+    bounds->setEmpty();
+    for (auto child : getRenderChildren()) {
+      SkRect childBounds;
+      if (!child->getBounds(&childBounds)) {
+        return false;
+      }
+      bounds->join(childBounds);
+    }
+    return true;
+  }
+
+  /**
+   Groups with many children (like the markers of a chart) use a grid over
+   the bounds of their children to avoid testing all of them.
+   */
+  void hitTestNode(const HitTestQuery &query,
+                   std::vector<size_t> *result) override {
+    if (getChildren().size() < MinChildrenForGrid) {
+      hitTestChildren(query, result);
+      return;
+    }
+
+    updateGrid();
+    for (auto index : _grid.query(query)) {
+      _gridChildren[index]->hitTest(query, result);
+    }
+  }
+
+  void onChildrenChanged() override {
+    JsiDomRenderNode::onChildrenChanged();
+    invalidateGrid();
+    _picture.clear();
+  }
+
+private:
+  void invalidateGrid() {
+    _grid.invalidate();
+    _gridChildren.clear();
+    _gridUpdates.clear();
+  }
+
+  void compactGridUpdates() {
+    std::sort(_gridUpdates.begin(), _gridUpdates.end());
+    _gridUpdates.erase(std::unique(_gridUpdates.begin(), _gridUpdates.end()),
+                       _gridUpdates.end());
+  }
+
+  /**
+   Builds the grid, or only moves the children that changed since the grid
+   was last used to the cells of their new bounds.
+   */
+  void updateGrid() {
+    if (_grid.isValid()) {
+      compactGridUpdates();
+      for (auto index : _gridUpdates) {
+        SkRect bounds;
+        auto hasBounds = _gridChildren[index]->getBounds(&bounds);
+        if (!_grid.update(index, hasBounds ? &bounds : nullptr)) {
+          invalidateGrid();
+          break;
+        }
+      }
+      _gridUpdates.clear();
+      if (_grid.isValid()) {
+        return;
+      }
+    }
+
     for (auto &child : getChildren()) {
       if (child->getNodeClass() == NodeClass::RenderNode) {
-        std::static_pointer_cast<JsiDomRenderNode>(child)->render(context);
+        _gridChildren.push_back(
+            std::static_pointer_cast<JsiDomRenderNode>(child));
+      }
+    }
+    std::vector<SkRect> bounds(_gridChildren.size());
+    std::vector<const SkRect *> boundsPtrs(_gridChildren.size());
+    for (size_t i = 0; i < _gridChildren.size(); i++) {
+      boundsPtrs[i] =
+          _gridChildren[i]->getBounds(&bounds[i]) ? &bounds[i] : nullptr;
+    }
+    _grid.build(boundsPtrs);
+  }
+
+  void renderChildren(DrawingContext *context) {
+    auto &children = getRenderChildren();
+    // Subtrees are only split up once, recordings don't start new ones
+    if (children.size() >= 2 && !context->isCapturing() &&
+        !context->isTaskContext() && renderInParallel(context)) {
+      return;
+    }
+    for (auto child : children) {
+      child->render(context);
+    }
+  }
+
+  /**
+   Groups with several large children (like the panels of a dashboard) record
+   the large children into separate pictures on the worker threads, and then
+   draw the pictures and the remaining children in order. Every recording has
+   its own drawing and declaration context, and each subtree is only rendered
+   by one thread. Returns false when there aren't enough large children.
+   */
+  bool renderInParallel(DrawingContext *context) {
+    auto &children = getRenderChildren();
+    auto canvas = context->getCanvas();
+    std::shared_ptr<ParallelRecorder> recorder;
+    for (auto child : children) {
+      if (countRenderNodes(child, MinNodesForTask) < MinNodesForTask) {
+        continue;
+      }
+      if (recorder == nullptr) {
+        recorder = std::make_shared<ParallelRecorder>(
+            canvas->getLocalToDevice(),
+            SkRect::Make(canvas->getDeviceClipBounds()));
+      }
+      recorder->addNode(child, context->makeTaskContext());
+    }
+    if (recorder == nullptr || recorder->getNodeCount() < 2) {
+      return false;
+    }
+
+    // The recorder is shared with the workers since they can start after
+    // this thread has recorded all nodes itself
+    auto workers = std::min(recorder->getNodeCount() - 1,
+                            RNSkPlatformContext::getWorkerThreadCount());
+    for (size_t i = 0; i < workers; i++) {
+      getContext()->runOnWorkerThread([recorder]() { recorder->run(); });
+    }
+    recorder->run();
+    recorder->wait();
+
+    size_t index = 0;
+    for (auto child : children) {
+      if (index < recorder->getNodeCount() &&
+          recorder->getNode(index) == child) {
+        recorder->draw(index++, canvas);
+      } else {
+        child->render(context);
+      }
+    }
+    return true;
+  }
+
+  /**
+   Large subtrees that haven't changed for a few frames are recorded into a
+   picture, which is then drawn instead of traversing the subtree. The picture
+   is a flat list of draw operations with resolved paints and geometry, and it
+   is recorded with an R-tree so that playback still skips what is outside of
+   the clip.
+
+   Adjacent shapes drawn with the same paint, like the cells of a chart, are
+   merged into a single path draw by a batching pass over the recording.
+
+   The picture is recorded with the scale, rotation and skew of the canvas so
+   that anything rasterized while recording (like cached shadows) has the
+   right resolution, but without the translation so that scrolling or moving
+   the group doesn't invalidate it. Subtrees with volatile nodes, like custom
+   drawings, are never recorded. Returns false when the children need to be
+   rendered directly.
+   */
+  bool renderFromPicture(DrawingContext *context) {
+    auto canvas = context->getCanvas();
+    auto matrix = canvas->getTotalMatrix();
+    auto paint = context->getPaint();
+    auto translation =
+        SkMatrix::Translate(matrix.getTranslateX(), matrix.getTranslateY());
+    matrix.setTranslateX(0);
+    matrix.setTranslateY(0);
+
+    if (context->isCapturing() || matrix.hasPerspective() ||
+        hasChildChanges() || hasVolatileDescendants() ||
+        paint != _picture.paint || matrix != _picture.matrix) {
+      _picture.clear();
+      _picture.paint = paint;
+      _picture.matrix = matrix;
+      return false;
+    }
+
+    if (_picture.picture == nullptr) {
+      // Only record once, when the subtree has been unchanged long enough
+      if (_picture.stableFrames++ != MinStableFrames) {
+        return false;
       }
+      SkRect bounds;
+      if (!getLocalBounds(&bounds) || bounds.isEmpty() ||
+          countRenderNodes(this) < MinNodesForPicture) {
+        return false;
+      }
+
+      // Recorded without an R-tree, which the batching pass adds
+      SkPictureRecorder recorder;
+      auto recordingCanvas =
+          recorder.beginRecording(matrix.mapRect(bounds).makeOutset(1, 1));
+      recordingCanvas->setMatrix(matrix);
+      context->setCanvas(recordingCanvas);
+      try {
+        renderChildren(context);
+      } catch (...) {
+        context->setCanvas(canvas);
+        throw;
+      }
+      context->setCanvas(canvas);
+      _picture.picture = RNSkBatchingCanvas::makeBatchedPicture(
+          recorder.finishRecordingAsPicture());
     }
+
+    canvas->save();
+    canvas->setMatrix(translation);
+    canvas->drawPicture(_picture.picture);
+    canvas->restore();
+    return true;
   }
+
+  /**
+   Counts the render nodes in the subtree, stopping once the limit is reached
+   */
+  static size_t countRenderNodes(JsiDomRenderNode *node,
+                                 size_t limit = SIZE_MAX) {
+    size_t count = 1;
+    for (auto child : node->getRenderChildren()) {
+      if (count >= limit) {
+        break;
+      }
+      count += countRenderNodes(child, limit - count);
+    }
+    return count;
+  }
+
+  struct PictureCache {
+    void clear() {
+      picture = nullptr;
+      paint = nullptr;
+      stableFrames = 0;
+    }
+    sk_sp<SkPicture> picture;
+    std::shared_ptr<SkPaint> paint;
+    SkMatrix matrix;
+    size_t stableFrames = 0;
+  };
+
+  static constexpr size_t MinChildrenForGrid = 32;
+  static constexpr size_t MinStableFrames = 2;
+  static constexpr size_t MinNodesForPicture = 16;
+  static constexpr size_t MinNodesForTask = 64;
+
+  HitTestGrid _grid;
+  std::vector<std::shared_ptr<JsiDomRenderNode>> _gridChildren;
+  // Indices in _gridChildren of the children that changed since the grid
+  // was last updated
+  std::vector<size_t> _gridUpdates;
+  std::shared_ptr<SkPaint> _gridPaint;
+  PictureCache _picture;
 };
 
 } // namespace RNSkia
@@ -61,9 +61,17 @@ public:
     auto background = context->getImageFilters()->pop();
     auto foreground = context->getImageFilters()->pop();
 
+    // Reuse the filter while its inputs are the same so that Skia can reuse
+    // cached filter results, which are keyed by the filter id.
     SkBlendMode blendMode = *_blendModeProp->getDerivedValue();
-    composeAndPush(context,
-                   SkImageFilters::Blend(blendMode, background, foreground));
+    if (_filter == nullptr || blendMode != _blendMode ||
+        background != _background || foreground != _foreground) {
+      _filter = SkImageFilters::Blend(blendMode, background, foreground);
+      _blendMode = blendMode;
+      _background = background;
+      _foreground = foreground;
+    }
+    composeAndPush(context, _filter);
   }
 
 protected:
@@ -75,6 +83,11 @@ protected:
 
 private:
   BlendModeProp *_blendModeProp;
+
+  sk_sp<SkImageFilter> _filter;
+  sk_sp<SkImageFilter> _background;
+  sk_sp<SkImageFilter> _foreground;
+  SkBlendMode _blendMode;
 };
 
 class JsiDropShadowImageFilterNode
@@ -87,43 +100,24 @@ public:
 
   void decorate(DeclarationContext *context) override {
 
-    auto color = _colorProp->getDerivedValue();
-    auto dx = _dxProp->value().getAsNumber();
-    auto dy = _dyProp->value().getAsNumber();
-    auto blur = _blurProp->value().getAsNumber();
     auto input = context->getImageFilters()->pop();
-
-    auto inner = _innerProp->isSet() && _innerProp->value().getAsBool();
-    auto shadowOnly =
-        _shadowOnlyProp->isSet() && _shadowOnlyProp->value().getAsBool();
-
-    if (inner) {
-      auto srcGraphic = SkImageFilters::ColorFilter(
-          SkColorFilters::Blend(SK_ColorBLACK, SkBlendMode::kDst), nullptr);
-      auto srcAlpha = SkImageFilters::ColorFilter(
-          SkColorFilters::Blend(SK_ColorBLACK, SkBlendMode::kSrcIn), nullptr);
-      auto f1 = SkImageFilters::ColorFilter(
-          SkColorFilters::Blend(*color, SkBlendMode::kSrcOut), nullptr);
-      auto f2 = SkImageFilters::Offset(dx, dy, f1);
-      auto f3 = SkImageFilters::Blur(blur, blur, SkTileMode::kDecal, f2);
-      auto f4 = SkImageFilters::Blend(SkBlendMode::kSrcIn, srcAlpha, f3);
-      if (shadowOnly) {
-        composeAndPush(context, f4);
-      } else {
-        composeAndPush(context, SkImageFilters::Compose(
-                                    input ? input : nullptr,
-                                    SkImageFilters::Blend(SkBlendMode::kSrcOver,
-                                                          srcGraphic, f4)));
-      }
-
-    } else {
-      composeAndPush(
-          context,
-          shadowOnly ? SkImageFilters::DropShadowOnly(
-                           dx, dy, blur, blur, *color, input ? input : nullptr)
-                     : SkImageFilters::DropShadow(dx, dy, blur, blur, *color,
-                                                  input ? input : nullptr));
+    DropShadowParams params = {
+        *_colorProp->getDerivedValue(),
+        static_cast<SkScalar>(_dxProp->value().getAsNumber()),
+        static_cast<SkScalar>(_dyProp->value().getAsNumber()),
+        static_cast<SkScalar>(_blurProp->value().getAsNumber()),
+        _innerProp->isSet() && _innerProp->value().getAsBool(),
+        _shadowOnlyProp->isSet() && _shadowOnlyProp->value().getAsBool()};
+
+    // Building the filter chain is only done when the parameters or the input
+    // changed. Reusing the filter also lets Skia reuse cached filter results,
+    // which are keyed by the filter id.
+    if (_filter == nullptr || input != _input || !(params == _params)) {
+      _filter = makeFilter(params, input);
+      _params = params;
+      _input = input;
     }
+    composeAndPush(context, _filter);
   }
 
 protected:
@@ -144,12 +138,61 @@ protected:
   }
 
 private:
+  struct DropShadowParams {
+    SkColor color;
+    SkScalar dx;
+    SkScalar dy;
+    SkScalar blur;
+    bool inner;
+    bool shadowOnly;
+
+    bool operator==(const DropShadowParams &other) const {
+      return color == other.color && dx == other.dx && dy == other.dy &&
+             blur == other.blur && inner == other.inner &&
+             shadowOnly == other.shadowOnly;
+    }
+  };
+
+  sk_sp<SkImageFilter> makeFilter(const DropShadowParams &params,
+                                  sk_sp<SkImageFilter> input) {
+    auto dx = params.dx;
+    auto dy = params.dy;
+    auto blur = params.blur;
+    if (params.inner) {
+      auto srcGraphic = SkImageFilters::ColorFilter(
+          SkColorFilters::Blend(SK_ColorBLACK, SkBlendMode::kDst), nullptr);
+      auto srcAlpha = SkImageFilters::ColorFilter(
+          SkColorFilters::Blend(SK_ColorBLACK, SkBlendMode::kSrcIn), nullptr);
+      auto f1 = SkImageFilters::ColorFilter(
+          SkColorFilters::Blend(params.color, SkBlendMode::kSrcOut), nullptr);
+      auto f2 = SkImageFilters::Offset(dx, dy, f1);
+      auto f3 = SkImageFilters::Blur(blur, blur, SkTileMode::kDecal, f2);
+      auto f4 = SkImageFilters::Blend(SkBlendMode::kSrcIn, srcAlpha, f3);
+      if (params.shadowOnly) {
+        return f4;
+      }
+      return SkImageFilters::Compose(
+          input ? input : nullptr,
+          SkImageFilters::Blend(SkBlendMode::kSrcOver, srcGraphic, f4));
+    }
+    return params.shadowOnly
+               ? SkImageFilters::DropShadowOnly(dx, dy, blur, blur,
+                                                params.color,
+                                                input ? input : nullptr)
+               : SkImageFilters::DropShadow(dx, dy, blur, blur, params.color,
+                                            input ? input : nullptr);
+  }
+
   NodeProp *_dxProp;
   NodeProp *_dyProp;
   NodeProp *_blurProp;
   ColorProp *_colorProp;
   NodeProp *_innerProp;
   NodeProp *_shadowOnlyProp;
+
+  sk_sp<SkImageFilter> _filter;
+  sk_sp<SkImageFilter> _input;
+  DropShadowParams _params;
 };
 
 class JsiDisplacementMapImageFilterNode
@@ -14,6 +14,15 @@ public:
       : JsiDomDrawingNode(context, "skImage") {}
 
 protected:
+  bool computeBounds(SkRect *bounds) override {
+    auto rects = _imageProps->getDerivedValue();
+    if (rects == nullptr) {
+      return false;
+    }
+    *bounds = rects->dst;
+    return true;
+  }
+
   void draw(DrawingContext *context) override {
     auto rects = _imageProps->getDerivedValue();
     auto image = _imageProps->getImage();
@@ -17,58 +17,62 @@ public:
 
 protected:
   void renderNode(DrawingContext *context) override {
-
+    // A paint node as the first child is used as the layer paint
     auto hasLayer = false;
-    auto children = getChildren();
-
-    // Is the first children a layer?
-    for (size_t i = 0; i < children.size(); ++i) {
-      if (i == 0) {
-        // Check for paint node as layer
-        if (children.at(i)->getNodeClass() == NodeClass::DeclarationNode) {
-          auto declarationNode =
-              std::static_pointer_cast<JsiDomDeclarationNode>(children.at(i));
-
-          if (declarationNode->getDeclarationType() == DeclarationType::Paint) {
-            // Yes, it is a paint node - which we can use as a layer.
-            auto declarationContext = context->getDeclarationContext();
-            auto layerNode =
-                std::static_pointer_cast<JsiDomDeclarationNode>(children.at(i));
-
-            // Save canvas with the paint node's paint!
-            declarationContext->save();
-            layerNode->decorate(declarationContext);
-            auto paint = declarationContext->getPaints()->pop();
-            declarationContext->restore();
-
-            if (paint) {
-              hasLayer = true;
-              context->getCanvas()->saveLayer(
-                  SkCanvas::SaveLayerRec(nullptr, paint.get(), nullptr, 0));
-            }
-
-            continue;
-          }
-        }
+    if (_layerPaintNode != nullptr) {
+      // The paint is only resolved again when the paint node changed
+      if (_layerPaint == nullptr || _layerPaintNode->hasSubtreeChanges()) {
+        auto declarationContext = context->getDeclarationContext();
+        declarationContext->save();
+        _layerPaintNode->decorate(declarationContext);
+        _layerPaint = declarationContext->getPaints()->pop();
+        declarationContext->restore();
       }
 
-      // Render rest of the children
-      if (children.at(i)->getNodeClass() == NodeClass::RenderNode) {
-        std::static_pointer_cast<JsiDomRenderNode>(children.at(i))
-            ->render(context);
+      if (_layerPaint) {
+        hasLayer = true;
+        context->getCanvas()->saveLayer(
+            SkCanvas::SaveLayerRec(nullptr, _layerPaint.get(), nullptr, 0));
       }
     }
 
+    // Render rest of the children
+    for (auto child : getRenderChildren()) {
+      child->render(context);
+    }
+
     if (hasLayer) {
       context->getCanvas()->restore();
     }
   }
 
+  void onChildrenChanged() override {
+    JsiDomRenderNode::onChildrenChanged();
+    _layerPaintNode = nullptr;
+    _layerPaint = nullptr;
+    auto &children = getChildren();
+    if (!children.empty() &&
+        children[0]->getNodeClass() == NodeClass::DeclarationNode) {
+      auto declarationNode =
+          static_cast<JsiDomDeclarationNode *>(children[0].get());
+      if (declarationNode->getDeclarationType() == DeclarationType::Paint) {
+        _layerPaintNode = declarationNode;
+      }
+    }
+  }
+
   void defineProperties(NodePropsContainer *container) override {
     JsiDomRenderNode::defineProperties(container);
   }
 
+  void hitTestNode(const HitTestQuery &query,
+                   std::vector<size_t> *result) override {
+    hitTestChildren(query, result);
+  }
+
 private:
+  JsiDomDeclarationNode *_layerPaintNode = nullptr;
+  std::shared_ptr<SkPaint> _layerPaint;
 };
 
 } // namespace RNSkia
@@ -14,6 +14,20 @@ public:
       : JsiDomDrawingNode(context, "skOval") {}
 
 protected:
+  bool computeBounds(SkRect *bounds) override {
+    auto rect = _rectProp->getDerivedValue();
+    if (rect == nullptr) {
+      return false;
+    }
+    *bounds = *rect;
+    return true;
+  }
+
+  bool getGeometryPath(SkPath *path) override {
+    path->addOval(*_rectProp->getDerivedValue());
+    return true;
+  }
+
   void draw(DrawingContext *context) override {
     context->getCanvas()->drawOval(*_rectProp->getDerivedValue(),
                                    *context->getPaint());
@@ -14,6 +14,15 @@ public:
       : JsiDomDrawingNode(context, "skPicture") {}
 
 protected:
+  bool computeBounds(SkRect *bounds) override {
+    auto picture = _pictureProp->getDerivedValue();
+    if (picture == nullptr) {
+      return false;
+    }
+    *bounds = picture->cullRect();
+    return true;
+  }
+
   void draw(DrawingContext *context) override {
     context->getCanvas()->drawPicture(_pictureProp->getDerivedValue());
   }
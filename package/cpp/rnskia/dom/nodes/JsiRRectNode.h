@@ -14,6 +14,20 @@ public:
       : JsiDomDrawingNode(context, "skRRect") {}
 
 protected:
+  bool computeBounds(SkRect *bounds) override {
+    auto rect = _rrectProp->getDerivedValue();
+    if (rect == nullptr) {
+      return false;
+    }
+    *bounds = rect->rect();
+    return true;
+  }
+
+  bool getGeometryPath(SkPath *path) override {
+    path->addRRect(*_rrectProp->getDerivedValue());
+    return true;
+  }
+
   void draw(DrawingContext *context) override {
     context->getCanvas()->drawRRect(*_rrectProp->getDerivedValue(),
                                     *context->getPaint());
@@ -15,6 +15,16 @@ public:
       : JsiDomDrawingNode(context, "skTextBlob") {}
 
 protected:
+  bool computeBounds(SkRect *bounds) override {
+    auto blob = _textBlobProp->getDerivedValue();
+    if (blob == nullptr) {
+      return false;
+    }
+    *bounds = blob->bounds().makeOffset(_xProp->value().getAsNumber(),
+                                        _yProp->value().getAsNumber());
+    return true;
+  }
+
   void draw(DrawingContext *context) override {
     auto blob = _textBlobProp->getDerivedValue();
     auto x = _xProp->value().getAsNumber();
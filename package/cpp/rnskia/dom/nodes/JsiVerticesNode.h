@@ -15,12 +15,25 @@ public:
   explicit JsiVerticesNode(std::shared_ptr<RNSkPlatformContext> context)
       : JsiDomDrawingNode(context, "skVertices") {}
 
+  /**
+   Vertex buffers are updated from JS without changing any prop.
+   */
+  bool isVolatile() override { return _verticesProps->hasBuffer(); }
+
 protected:
+  /**
+   Commits of a vertex buffer redraw the view as soon as the buffer is set,
+   also when this node was culled or not drawn yet.
+   */
+  void onPropertiesCommitted(DomRenderContext *context) override {
+    _verticesProps->setRequestRedraw(context->getRequestRedraw());
+  }
+
   void draw(DrawingContext *context) override {
     SkBlendMode defaultBlendMode = _verticesProps->hasColors()
                                        ? SkBlendMode::kDstOver
                                        : SkBlendMode::kSrcOver;
-    context->getCanvas()->drawVertices(_verticesProps->getDerivedValue(),
+    context->getCanvas()->drawVertices(_verticesProps->getVertices(),
                                        _blendModeProp->isSet()
                                            ? *_blendModeProp->getDerivedValue()
                                            : defaultBlendMode,
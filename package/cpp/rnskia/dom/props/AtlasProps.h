@@ -0,0 +1,114 @@
+#pragma once
+
+#include "DerivedNodeProp.h"
+#include "ImageProps.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkColor.h"
+#include "SkRSXform.h"
+#include "SkRect.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+struct AtlasSprites {
+  std::vector<SkRect> rects;
+  std::vector<SkRSXform> transforms;
+  std::vector<SkColor> colors;
+  SkRect bounds;
+};
+
+/**
+ The sprites of an atlas node, read from Float32Arrays of [x, y, width,
+ height] source rectangles, [scos, ssin, tx, ty] transforms and optional
+ [r, g, b, a] colors, as taken by drawAtlas on the canvas. Only converted
+ when one of these props changes, so that drawing all the sprites is a single
+ drawAtlas call.
+ */
+class AtlasProps : public DerivedProp<AtlasSprites> {
+public:
+  explicit AtlasProps(const std::function<void(BaseNodeProp *)> &onChange)
+      : DerivedProp<AtlasSprites>(onChange) {
+    _imageProp = defineProperty<ImageProp>(PropNameImage);
+    _spritesProp = defineProperty<NodeProp>("sprites");
+    _transformsProp = defineProperty<NodeProp>("transforms");
+    _colorsProp = defineProperty<NodeProp>("colors");
+
+    _spritesProp->require();
+    _transformsProp->require();
+  }
+
+  sk_sp<SkImage> getImage() { return _imageProp->getDerivedValue(); }
+
+  void updateDerivedValue() override {
+    if (!_spritesProp->isChanged() && !_transformsProp->isChanged() &&
+        !_colorsProp->isChanged() && getDerivedValue() != nullptr) {
+      // Only the image changed
+      return;
+    }
+
+    auto &rects = getFloats(_spritesProp);
+    auto &transforms = getFloats(_transformsProp);
+    auto size = std::min(rects.size(), transforms.size()) / 4;
+
+    AtlasSprites sprites;
+    sprites.rects.reserve(size);
+    sprites.transforms.resize(size);
+    memcpy(sprites.transforms.data(), transforms.data(),
+           sizeof(SkRSXform) * size);
+    sprites.bounds = SkRect::MakeEmpty();
+    for (size_t i = 0; i < size; i++) {
+      auto rect = SkRect::MakeXYWH(rects[i * 4], rects[i * 4 + 1],
+                                   rects[i * 4 + 2], rects[i * 4 + 3]);
+      SkPoint quad[4];
+      sprites.transforms[i].toQuad(rect.width(), rect.height(), quad);
+      SkRect spriteBounds;
+      spriteBounds.setBounds(quad, 4);
+      sprites.bounds.join(spriteBounds);
+      sprites.rects.push_back(rect);
+    }
+
+    if (_colorsProp->isSet()) {
+      auto &colors = getFloats(_colorsProp);
+      if (colors.size() / 4 < size) {
+        throw std::runtime_error("Expected one color for each sprite.");
+      }
+      sprites.colors.reserve(size);
+      for (size_t i = 0; i < size; i++) {
+        sprites.colors.push_back(SkColor4f{colors[i * 4], colors[i * 4 + 1],
+                                           colors[i * 4 + 2],
+                                           colors[i * 4 + 3]}
+                                     .toSkColor());
+      }
+    }
+
+    setDerivedValue(std::move(sprites));
+  }
+
+private:
+  const std::vector<float> &getFloats(NodeProp *prop) {
+    if (prop->value().getType() != PropType::Float32Array) {
+      throw std::runtime_error("Expected a Float32Array for the " +
+                               prop->getName() + " property.");
+    }
+    return prop->value().getAsFloat32Array();
+  }
+
+  ImageProp *_imageProp;
+  NodeProp *_spritesProp;
+  NodeProp *_transformsProp;
+  NodeProp *_colorsProp;
+};
+
+} // namespace RNSkia
@@ -49,6 +49,11 @@ public:
   SkScalar getSpread() {
     return _spreadProp->isSet() ? _spreadProp->value().getAsNumber() : 0;
   }
+  SkScalar getBlur() { return _blurProp->value().getAsNumber(); }
+  SkColor getColor() {
+    return _colorProp->isSet() ? *_colorProp->getDerivedValue()
+                               : SK_ColorBLACK;
+  }
 
 private:
   NodeProp *_dxProp;
@@ -33,7 +33,14 @@ public:
   }
 
   static SkColor parseColorValue(const JsiValue &color) {
-    if (color.getType() == PropType::Object) {
+    if (color.getType() == PropType::Float32Array) {
+      auto &rgba = color.getAsFloat32Array();
+      if (rgba.size() < 4) {
+        throw std::runtime_error("Expected 4 components in color array.");
+      }
+      return SkColorSetARGB(rgba[3] * 255.0f, rgba[0] * 255.0f,
+                            rgba[1] * 255.0f, rgba[2] * 255.0f);
+    } else if (color.getType() == PropType::Object) {
       // Float array
       auto r = color.getValue(PropName0);
       auto g = color.getValue(PropName1);
@@ -0,0 +1,192 @@
+#pragma once
+
+#include "DerivedNodeProp.h"
+#include "PathMorphProp.h"
+#include "RNSkContourMeasureCache.h"
+#include "RectProp.h"
+#include "StrokeProps.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkPaint.h"
+#include "SkPath.h"
+#include "SkPathUtils.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+static PropId PropNameMiterLimit = JsiPropId::get("miter_limit");
+static PropId PropNamePrecision = JsiPropId::get("precision");
+
+/**
+ The geometry drawn by a path node: the path trimmed to start / end, with the
+ fill type set and converted to its stroked outline. Only recomputed when one
+ of these props changes, not when the paint does.
+
+ Trimming uses the cached contours of the path, so animating start or end
+ only extracts the segments without measuring the whole path again, and only
+ the trimmed segments are stroked.
+ */
+class PathGeometryProp : public DerivedProp<const SkPath> {
+public:
+  explicit PathGeometryProp(
+      const std::function<void(BaseNodeProp *)> &onChange)
+      : DerivedProp<const SkPath>(onChange) {
+    _pathProp = defineProperty<PathMorphProp>("path");
+    _startProp = defineProperty<NodeProp>("start");
+    _endProp = defineProperty<NodeProp>("end");
+    _fillTypeProp = defineProperty<NodeProp>("fillType");
+    _strokeOptsProp = defineProperty<NodeProp>("stroke");
+  }
+
+  /**
+   The prop is set when there is a path, even if stroking it failed
+   */
+  bool isSet() override { return _pathProp->isSet(); }
+
+  void updateDerivedValue() override {
+    auto source = _pathProp->getDerivedValue();
+    if (source == nullptr) {
+      setDerivedValue(nullptr);
+      return;
+    }
+
+    auto start = saturate(
+        _startProp->isSet() ? _startProp->value().getAsNumber() : 0.0);
+    auto end =
+        saturate(_endProp->isSet() ? _endProp->value().getAsNumber() : 1.0);
+    if (_strokeOptsProp->isChanged()) {
+      updateStrokePaint();
+    }
+
+    auto isTrimmed = start != 0.0 || end != 1.0;
+    if (!isTrimmed && !_fillTypeProp->isSet() && !_hasStroke) {
+      // Nothing to change, use the path directly
+      setDerivedValue(source);
+      return;
+    }
+
+    SkPath path;
+    if (isTrimmed) {
+      trim(*source, start, end, &path);
+    } else {
+      path = *source;
+    }
+
+    if (_fillTypeProp->isSet()) {
+      path.setFillType(
+          getFillTypeFromStringValue(_fillTypeProp->value().getAsString()));
+    }
+
+    if (_hasStroke) {
+      SkPath stroked;
+      if (!skpathutils::FillPathWithPaint(path, _strokePaint, &stroked,
+                                          nullptr, _precision)) {
+        setDerivedValue(nullptr);
+        return;
+      }
+      path.swap(stroked);
+    }
+
+    setDerivedValue(std::make_shared<const SkPath>(std::move(path)));
+  }
+
+private:
+  float saturate(float x) { return std::max(0.0f, std::min(1.0f, x)); }
+
+  /**
+   Same result as SkTrimPathEffect in normal mode, from the cached contours
+   */
+  void trim(const SkPath &source, float start, float end, SkPath *result) {
+    auto contours =
+        RNSkContourMeasureCache::getInstance().getContours(source, false, 1);
+    SkScalar length = 0;
+    for (auto &contour : *contours) {
+      length += contour->length();
+    }
+
+    auto startDistance = start * length;
+    auto endDistance = end * length;
+    SkScalar distance = 0;
+    for (auto &contour : *contours) {
+      auto contourEnd = distance + contour->length();
+      if (startDistance < contourEnd && endDistance > distance) {
+        contour->getSegment(startDistance - distance, endDistance - distance,
+                            result, true);
+      }
+      distance = contourEnd;
+      if (distance >= endDistance) {
+        break;
+      }
+    }
+    result->setFillType(source.getFillType());
+  }
+
+  void updateStrokePaint() {
+    _hasStroke = _strokeOptsProp->isSet() &&
+                 _strokeOptsProp->value().getType() == PropType::Object;
+    _strokePaint = SkPaint();
+    _strokePaint.setStyle(SkPaint::kStroke_Style);
+    _precision = 1.0;
+    if (!_hasStroke) {
+      return;
+    }
+
+    auto opts = _strokeOptsProp->value();
+    if (opts.hasValue(JsiPropId::get("strokeCap"))) {
+      _strokePaint.setStrokeCap(StrokeCapProp::getCapFromString(
+          opts.getValue(JsiPropId::get("strokeCap")).getAsString()));
+    }
+
+    if (opts.hasValue(JsiPropId::get("strokeJoin"))) {
+      _strokePaint.setStrokeJoin(StrokeJoinProp::getJoinFromString(
+          opts.getValue(JsiPropId::get("strokeJoin")).getAsString()));
+    }
+
+    if (opts.hasValue(PropNameWidth)) {
+      _strokePaint.setStrokeWidth(opts.getValue(PropNameWidth).getAsNumber());
+    }
+
+    if (opts.hasValue(PropNameMiterLimit)) {
+      _strokePaint.setStrokeMiter(
+          opts.getValue(PropNameMiterLimit).getAsNumber());
+    }
+
+    if (opts.hasValue(PropNamePrecision)) {
+      _precision = opts.getValue(PropNamePrecision).getAsNumber();
+    }
+  }
+
+  SkPathFillType getFillTypeFromStringValue(const std::string &value) {
+    if (value == "winding") {
+      return SkPathFillType::kWinding;
+    } else if (value == "evenOdd") {
+      return SkPathFillType::kEvenOdd;
+    } else if (value == "inverseWinding") {
+      return SkPathFillType::kInverseWinding;
+    } else if (value == "inverseEvenOdd") {
+      return SkPathFillType::kInverseEvenOdd;
+    }
+    throw std::runtime_error("Could not convert value \"" + value +
+                             "\" to path fill type.");
+  }
+
+  PathMorphProp *_pathProp;
+  NodeProp *_startProp;
+  NodeProp *_endProp;
+  NodeProp *_fillTypeProp;
+  NodeProp *_strokeOptsProp;
+
+  bool _hasStroke = false;
+  SkPaint _strokePaint;
+  SkScalar _precision = 1.0;
+};
+
+} // namespace RNSkia
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "DerivedNodeProp.h"
+#include "PathProp.h"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdocumentation"
+
+#include "SkPath.h"
+
+#pragma clang diagnostic pop
+
+namespace RNSkia {
+
+static PropId PropNameMorph = JsiPropId::get("morph");
+static PropId PropNameProgress = JsiPropId::get("progress");
+
+/**
+ Path prop that can morph between keyframes. The path is the first keyframe
+ and the paths in the morph prop are the following ones, with progress going
+ from 0 (first keyframe) to 1 (last keyframe). All keyframes must have the same
+ verbs.
+
+ The verbs and points of the keyframes are extracted when they are set, so
+ that a change in progress (like when it is driven by an animated value) only
+ blends two point arrays without calling into JS.
+ */
+class PathMorphProp : public DerivedProp<const SkPath> {
+public:
+  explicit PathMorphProp(PropId name,
+                         const std::function<void(BaseNodeProp *)> &onChange)
+      : DerivedProp<const SkPath>(onChange) {
+    _pathProp = defineProperty<PathProp>(name);
+    _morphProp = defineProperty<NodeProp>(PropNameMorph);
+    _progressProp = defineProperty<NodeProp>(PropNameProgress);
+  }
+
+  void updateDerivedValue() override {
+    if (!_pathProp->isSet()) {
+      _keyframes.clear();
+      setDerivedValue(nullptr);
+      return;
+    }
+    if (!_morphProp->isSet()) {
+      _keyframes.clear();
+      setDerivedValue(_pathProp->getDerivedValue());
+      return;
+    }
+
+    if (_pathProp->isChanged() || _morphProp->isChanged() ||
+        _keyframes.size() < 2) {
+      updateKeyframes();
+    }
+    if (_keyframes.size() < 2) {
+      setDerivedValue(nullptr);
+      return;
+    }
+
+    auto progress = _progressProp->isSet()
+                        ? static_cast<float>(
+                              _progressProp->value().getAsNumber())
+                        : 0.0f;
+    progress = std::max(0.0f, std::min(1.0f, progress));
+    auto position = progress * (_keyframes.size() - 1);
+    auto index = std::min(static_cast<size_t>(position), _keyframes.size() - 2);
+    auto t = position - index;
+
+    if (t == 0.0f) {
+      setDerivedValue(_keyframes[index].path);
+    } else if (t == 1.0f) {
+      setDerivedValue(_keyframes[index + 1].path);
+    } else {
+      setDerivedValue(blend(_keyframes[index], _keyframes[index + 1], t));
+    }
+  }
+
+private:
+  struct Keyframe {
+    std::shared_ptr<const SkPath> path;
+    std::vector<SkPoint> points;
+  };
+
+  void updateKeyframes() {
+    // Built aside so that invalid keyframes leave no keyframes behind, and
+    // are validated again on the next update instead of being blended
+    _keyframes.clear();
+    std::vector<Keyframe> keyframes;
+    keyframes.push_back(makeKeyframe(_pathProp->getDerivedValue()));
+    for (auto &value : _morphProp->value().getAsArray()) {
+      auto path = PathProp::processPath(value);
+      if (path == nullptr) {
+        throw std::runtime_error("Expected an array of paths in morph prop.");
+      }
+      if (!keyframes[0].path->isInterpolatable(*path)) {
+        throw std::runtime_error(
+            "Paths in morph prop must have the same verbs as the path.");
+      }
+      keyframes.push_back(makeKeyframe(path));
+    }
+    if (keyframes.size() < 2) {
+      throw std::runtime_error("Expected at least one path in morph prop.");
+    }
+    _keyframes.swap(keyframes);
+
+    // Verbs and conic weights are shared by all keyframes
+    auto &first = *_keyframes[0].path;
+    _verbs.resize(first.countVerbs());
+    first.getVerbs(_verbs.data(), static_cast<int>(_verbs.size()));
+    _conicWeights.clear();
+    if (first.getSegmentMasks() & SkPath::kConic_SegmentMask) {
+      SkPath::RawIter iter(first);
+      SkPoint points[4];
+      SkPath::Verb verb;
+      while ((verb = iter.next(points)) != SkPath::kDone_Verb) {
+        if (verb == SkPath::kConic_Verb) {
+          _conicWeights.push_back(iter.conicWeight());
+        }
+      }
+    }
+    _blended.resize(_keyframes[0].points.size());
+  }
+
+  Keyframe makeKeyframe(std::shared_ptr<const SkPath> path) {
+    Keyframe keyframe;
+    keyframe.points.resize(path->countPoints());
+    path->getPoints(keyframe.points.data(),
+                    static_cast<int>(keyframe.points.size()));
+    keyframe.path = std::move(path);
+    return keyframe;
+  }
+
+  std::shared_ptr<const SkPath> blend(const Keyframe &from,
+                                      const Keyframe &to, float t) {
+    // Plain loop over the coordinates so that the compiler vectorizes it
+    auto count = _blended.size() * 2;
+    auto a = reinterpret_cast<const float *>(from.points.data());
+    auto b = reinterpret_cast<const float *>(to.points.data());
+    auto out = reinterpret_cast<float *>(_blended.data());
+    for (size_t i = 0; i < count; i++) {
+      out[i] = a[i] + (b[i] - a[i]) * t;
+    }
+
+    // Volatile since the path changes every frame while animating
+    return std::make_shared<const SkPath>(SkPath::Make(
+        _blended.data(), static_cast<int>(_blended.size()), _verbs.data(),
+        static_cast<int>(_verbs.size()), _conicWeights.data(),
+        static_cast<int>(_conicWeights.size()), from.path->getFillType(),
+        true));
+  }
+
+  PathProp *_pathProp;
+  NodeProp *_morphProp;
+  NodeProp *_progressProp;
+
+  std::vector<Keyframe> _keyframes;
+  std::vector<uint8_t> _verbs;
+  std::vector<SkScalar> _conicWeights;
+  std::vector<SkPoint> _blended;
+};
+
+} // namespace RNSkia
@@ -2,6 +2,7 @@
 
 #include "DerivedNodeProp.h"
 #include "JsiSkPath.h"
+#include "RNSkPathCache.h"
 
 #include <memory>
 
@@ -14,15 +15,15 @@
 
 namespace RNSkia {
 
-class PathProp : public DerivedProp<SkPath> {
+class PathProp : public DerivedProp<const SkPath> {
 public:
   explicit PathProp(PropId name,
                     const std::function<void(BaseNodeProp *)> &onChange)
-      : DerivedProp<SkPath>(onChange) {
+      : DerivedProp<const SkPath>(onChange) {
     _pathProp = defineProperty<NodeProp>(name);
   }
 
-  static std::shared_ptr<SkPath> processPath(const JsiValue &value) {
+  static std::shared_ptr<const SkPath> processPath(const JsiValue &value) {
     if (value.getType() == PropType::HostObject) {
       // Try reading as Path
       auto ptr = std::dynamic_pointer_cast<JsiSkPath>(value.getAsHostObject());
@@ -30,15 +31,12 @@ public:
         return ptr->getObject();
       }
     } else if (value.getType() == PropType::String) {
-      // Read as string
-      auto pathString = value.getAsString();
-      SkPath result;
-
-      if (SkParsePath::FromSVGString(pathString.c_str(), &result)) {
-        return std::make_shared<SkPath>(result);
-      } else {
+      // Read as string, equal strings share the same parsed path
+      auto path = RNSkPathCache::getInstance().getPath(value.getAsString());
+      if (path == nullptr) {
         throw std::runtime_error("Could not parse path from string.");
       }
+      return path;
     }
     return nullptr;
   }
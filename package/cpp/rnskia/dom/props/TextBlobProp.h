@@ -3,6 +3,7 @@
 #include "DerivedNodeProp.h"
 
 #include "JsiSkTextBlob.h"
+#include "RNSkContourMeasureCache.h"
 
 #include <memory>
 #include <string>
@@ -77,9 +78,11 @@ public:
                             nullptr); // TODO: Should we use paint somehow here?
 
       std::vector<SkRSXform> rsx;
-      SkContourMeasureIter meas(*path, false, 1);
+      auto contours =
+          RNSkContourMeasureCache::getInstance().getContours(*path, false, 1);
+      size_t contourIndex = 0;
 
-      auto cont = meas.next();
+      auto cont = contours->empty() ? nullptr : (*contours)[0].get();
       auto dist = offset;
 
       for (size_t i = 0; i < text.length() && cont != nullptr; ++i) {
@@ -87,7 +90,9 @@ public:
         dist += width / 2;
         if (dist > cont->length()) {
           // jump to next contour
-          cont = meas.next();
+          cont = ++contourIndex < contours->size()
+                     ? (*contours)[contourIndex].get()
+                     : nullptr;
           if (cont == nullptr) {
             // We have come to the end of the path - terminate the string
             // right here.
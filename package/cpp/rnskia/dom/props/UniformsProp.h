@@ -41,6 +41,9 @@ void processValue(std::vector<SkScalar> &values, const JsiValue &value) {
       auto a = arrayValue[i];
       processValue(values, a);
     }
+  } else if (value.getType() == PropType::Float32Array) {
+    auto &floats = value.getAsFloat32Array();
+    values.insert(values.end(), floats.begin(), floats.end());
   } else if (isJSPoint(value) || isSkPoint(value)) {
     auto pointValue = PointProp::processValue(value);
     values.push_back(pointValue.x());
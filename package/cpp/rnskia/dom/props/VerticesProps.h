@@ -3,11 +3,15 @@
 #include "DerivedNodeProp.h"
 
 #include "ColorProp.h"
+#include "JsiSkVertexBuffer.h"
 #include "NumbersProp.h"
+#include "PointProp.h"
 #include "PointsProp.h"
 #include "VertexModeProp.h"
 
+#include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #pragma clang diagnostic push
@@ -19,13 +23,19 @@
 
 namespace RNSkia {
 
+/**
+ Vertices from the vertices, colors, textures and indices props, or from a
+ vertex buffer when the vertices prop is one. A vertex buffer is updated in
+ place from JS without changing any prop, so the prop draws what the buffer
+ last committed and changes whenever the buffer is committed again.
+ */
 class VerticesProps : public DerivedSkProp<SkVertices> {
 public:
   explicit VerticesProps(const std::function<void(BaseNodeProp *)> &onChange)
       : DerivedSkProp<SkVertices>(onChange) {
     _vertexModeProp = defineProperty<VertexModeProp>("mode");
     _colorsProp = defineProperty<ColorsProp>("colors");
-    _verticesProp = defineProperty<PointsProp>("vertices");
+    _verticesProp = defineProperty<NodeProp>("vertices");
     _texturesProp = defineProperty<PointsProp>("textures");
     _indicesProp = defineProperty<Numbers16Prop>("indices");
 
@@ -33,19 +43,68 @@ public:
     _verticesProp->require();
   }
 
-  bool hasColors() { return _colorsProp->isSet(); }
+  ~VerticesProps() { setBuffer(nullptr); }
+
+  bool hasColors() {
+    return _buffer != nullptr ? _buffer->colors != nullptr
+                              : _colorsProp->isSet();
+  }
+
+  /**
+   Returns true if the vertices are read from a vertex buffer
+   */
+  bool hasBuffer() { return _buffer != nullptr; }
+
+  /**
+   Returns the vertices to draw
+   */
+  sk_sp<SkVertices> getVertices() { return getDerivedValue(); }
+
+  /**
+   Makes commits of the vertex buffer request a redraw of the view rendering
+   these props.
+   */
+  void setRequestRedraw(const std::function<void()> &requestRedraw) {
+    if (_buffer != nullptr && !_hasListener) {
+      _buffer->addListener(this, requestRedraw);
+      _hasListener = true;
+    }
+  }
+
+  void updatePendingChanges() override {
+    DerivedSkProp<SkVertices>::updatePendingChanges();
+    if (_buffer != nullptr && _buffer->getVersion() != _bufferVersion) {
+      updateFromBuffer();
+    }
+  }
 
   void updateDerivedValue() override {
+    auto &value = _verticesProp->value();
+    auto buffer = value.getType() == PropType::HostObject
+                      ? std::dynamic_pointer_cast<JsiSkVertexBuffer>(
+                            value.getAsHostObject())
+                      : nullptr;
+    setBuffer(buffer != nullptr ? buffer->getObject() : nullptr);
+    if (_buffer != nullptr) {
+      updateFromBuffer();
+      return;
+    }
+
     const SkVertices::VertexMode *vertextMode =
         _vertexModeProp->getDerivedValue().get();
     const std::vector<SkColor> *colors = _colorsProp->getDerivedValue().get();
-    auto vertices = _verticesProp->getDerivedValue();
     auto textures = _texturesProp->getDerivedValue();
     auto indices = _indicesProp->getDerivedValue();
 
+    auto &verticesArray = value.getAsArray();
+    std::vector<SkPoint> vertices;
+    vertices.reserve(verticesArray.size());
+    for (auto &point : verticesArray) {
+      vertices.push_back(PointProp::processValue(point));
+    }
+
     setDerivedValue(SkVertices::MakeCopy(
-        *vertextMode, static_cast<int>(vertices->size()),
-        _verticesProp->isSet() ? vertices->data() : nullptr,
+        *vertextMode, static_cast<int>(vertices.size()), vertices.data(),
         _texturesProp->isSet() ? textures->data() : nullptr,
         _colorsProp->isSet() ? colors->data() : nullptr,
         _indicesProp->isSet() ? static_cast<int>(indices->size()) : 0,
@@ -55,9 +114,30 @@ public:
 private:
   VertexModeProp *_vertexModeProp;
   ColorsProp *_colorsProp;
-  PointsProp *_verticesProp;
+  NodeProp *_verticesProp;
   PointsProp *_texturesProp;
   Numbers16Prop *_indicesProp;
+
+  void setBuffer(std::shared_ptr<VertexArrays> buffer) {
+    if (buffer == _buffer) {
+      return;
+    }
+    if (_buffer != nullptr && _hasListener) {
+      _buffer->removeListener(this);
+    }
+    _buffer = std::move(buffer);
+    _hasListener = false;
+  }
+
+  void updateFromBuffer() {
+    // Version first, a commit in between is then picked up next frame
+    _bufferVersion = _buffer->getVersion();
+    setDerivedValue(_buffer->getCommitted());
+  }
+
+  std::shared_ptr<VertexArrays> _buffer;
+  size_t _bufferVersion = 0;
+  bool _hasListener = false;
 };
 
 } // namespace RNSkia
@@ -1,6 +1,7 @@
 #import "SkiaManager.h"
 
 #import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
 
 #import <React/RCTBridge+Private.h>
 #import <React/RCTBridge.h>
@@ -20,6 +21,10 @@
 }
 
 - (void)invalidate {
+  [[NSNotificationCenter defaultCenter]
+      removeObserver:self
+                name:UIApplicationDidReceiveMemoryWarningNotification
+              object:nil];
   if (_skManager != nullptr) {
     _skManager->invalidate();
   }
@@ -39,9 +44,22 @@
       _skManager = std::make_shared<RNSkia::RNSkManager>(
           jsRuntime, bridge.jsCallInvoker,
           std::make_shared<RNSkia::RNSkiOSPlatformContext>(jsRuntime, bridge));
+
+      // Release the pooled surfaces when the system is low on memory
+      [[NSNotificationCenter defaultCenter]
+          addObserver:self
+             selector:@selector(didReceiveMemoryWarning)
+                 name:UIApplicationDidReceiveMemoryWarningNotification
+               object:nil];
     }
   }
   return self;
 }
 
+- (void)didReceiveMemoryWarning {
+  if (_skManager != nullptr) {
+    _skManager->didReceiveMemoryWarning();
+  }
+}
+
 @end
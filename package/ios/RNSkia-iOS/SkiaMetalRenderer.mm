@@ -11,43 +11,56 @@
 
 #import <MetalKit/MetalKit.h>
 
+#include <chrono>
+
+// Textures of deleted surfaces are kept for new surfaces of the same size,
+// up to this budget and as long as they were used recently
+static constexpr size_t OffscreenResourceCacheBytes = 32 * 1024 * 1024;
+static constexpr std::chrono::seconds OffscreenResourceIdleTime{10};
+
+/**
+ Metal device, queue and Skia context for offscreen surfaces, created once per
+ thread and shared by all offscreen surfaces made on that thread. Destroyed
+ when the thread exits, the Javascript thread for instance exits when the app
+ is reloaded.
+ */
 struct OffscreenRenderContext {
   id<MTLDevice> device;
   id<MTLCommandQueue> commandQueue;
   sk_sp<GrDirectContext> skiaContext;
-  id<MTLTexture> texture;
 
-  OffscreenRenderContext(int width, int height) {
+  OffscreenRenderContext() {
     device = MTLCreateSystemDefaultDevice();
     commandQueue =
         id<MTLCommandQueue>(CFRetain((GrMTLHandle)[device newCommandQueue]));
     skiaContext = GrDirectContext::MakeMetal((__bridge void *)device,
                                              (__bridge void *)commandQueue);
-    // Create a Metal texture descriptor
-    MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor
-        texture2DDescriptorWithPixelFormat:MTLPixelFormatBGRA8Unorm
-                                     width:width
-                                    height:height
-                                 mipmapped:NO];
-    textureDescriptor.usage =
-        MTLTextureUsageRenderTarget | MTLTextureUsageShaderRead;
-    texture = [device newTextureWithDescriptor:textureDescriptor];
+    if (skiaContext != nullptr) {
+      skiaContext->setResourceCacheLimit(OffscreenResourceCacheBytes);
+    }
+  }
+
+  ~OffscreenRenderContext() {
+    if (skiaContext != nullptr) {
+      // Surfaces still alive keep the Skia context, which must not use the
+      // queue once it is released
+      skiaContext->releaseResourcesAndAbandonContext();
+      skiaContext = nullptr;
+    }
+    CFRelease((__bridge CFTypeRef)commandQueue);
   }
 };
 
 sk_sp<SkSurface> MakeOffscreenMetalSurface(int width, int height) {
-  auto ctx = new OffscreenRenderContext(width, height);
-
-  // Create a GrBackendTexture from the Metal texture
-  GrMtlTextureInfo info;
-  info.fTexture.retain((__bridge void *)ctx->texture);
-  GrBackendTexture backendTexture(width, height, GrMipMapped::kNo, info);
-
-  // Create a SkSurface from the GrBackendTexture
-  auto surface = SkSurface::MakeFromBackendTexture(
-      ctx->skiaContext.get(), backendTexture, kTopLeft_GrSurfaceOrigin, 0,
-      kBGRA_8888_SkColorType, nullptr, nullptr,
-      [](void *addr) { delete (OffscreenRenderContext *)addr; }, ctx);
+  thread_local OffscreenRenderContext ctx;
+  if (ctx.skiaContext == nullptr) {
+    return nullptr;
+  }
+  ctx.skiaContext->performDeferredCleanup(OffscreenResourceIdleTime);
 
-  return surface;
+  return SkSurface::MakeRenderTarget(
+      ctx.skiaContext.get(), SkBudgeted::kYes,
+      SkImageInfo::Make(width, height, kBGRA_8888_SkColorType,
+                        kPremul_SkAlphaType),
+      0, kTopLeft_GrSurfaceOrigin, nullptr);
 }
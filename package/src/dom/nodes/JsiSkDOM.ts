@@ -19,6 +19,7 @@ import type {
   RectProps,
   RoundedRectProps,
   VerticesProps,
+  AtlasProps,
   TextProps,
   DiffRectProps,
   OffsetImageFilterProps,
@@ -69,6 +70,7 @@ import {
   RectNode,
   RRectNode,
   VerticesNode,
+  AtlasNode,
   TextNode,
   OvalNode,
   CustomDrawingNode,
@@ -218,6 +220,12 @@ export class JsiSkDOM implements SkDOM {
       : new VerticesNode(this.ctx, props);
   }
 
+  Atlas(props: AtlasProps) {
+    return NATIVE_DOM
+      ? global.SkiaDomApi.AtlasNode(props)
+      : new AtlasNode(this.ctx, props);
+  }
+
   Text(props: TextProps) {
     return NATIVE_DOM
       ? global.SkiaDomApi.TextNode(props)
@@ -13,7 +13,10 @@ export interface NodeContext {
   depMgr: DependencyManager;
 }
 
+let nodeIdent = 1000;
+
 export abstract class JsiNode<P> implements Node<P> {
+  public readonly nodeId = nodeIdent++;
   protected _children: JsiNode<unknown>[] = [];
   protected Skia: Skia;
   protected depMgr: DependencyManager;
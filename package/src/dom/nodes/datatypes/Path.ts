@@ -1,3 +1,4 @@
+import { saturate } from "../../../renderer/processors/math";
 import type { Skia } from "../../../skia/types";
 import { isPath } from "../../../skia/types";
 import type { PathDef } from "../../types";
@@ -13,6 +14,28 @@ export const processPath = (Skia: Skia, rawPath: PathDef) => {
   return path;
 };
 
+export const morphPath = (
+  Skia: Skia,
+  rawPath: PathDef,
+  morph: PathDef[],
+  progress: number
+) => {
+  const keyframes = [rawPath, ...morph].map((def) => processPath(Skia, def));
+  if (keyframes.length < 2) {
+    throw new Error("Expected at least one path in morph prop.");
+  }
+  const position = saturate(progress) * (keyframes.length - 1);
+  const index = Math.min(Math.floor(position), keyframes.length - 2);
+  const t = position - index;
+  const path = keyframes[index + 1].interpolate(keyframes[index], t);
+  if (!path) {
+    throw new Error(
+      "Paths in morph prop must have the same verbs as the path."
+    );
+  }
+  return path;
+};
+
 // eslint-disable-next-line @typescript-eslint/no-explicit-any
 export const isPathDef = (def: any): def is PathDef =>
   typeof def === "string" || isPath(def);
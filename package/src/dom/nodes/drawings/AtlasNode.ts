@@ -0,0 +1,26 @@
+import { BlendMode } from "../../../skia/types";
+import type { AtlasProps, DrawingContext } from "../../types";
+import { NodeType } from "../../types";
+import { enumKey } from "../datatypes";
+import { JsiDrawingNode } from "../DrawingNode";
+import type { NodeContext } from "../Node";
+
+export class AtlasNode extends JsiDrawingNode<AtlasProps, null> {
+  constructor(ctx: NodeContext, props: AtlasProps) {
+    super(ctx, NodeType.Atlas, props);
+  }
+
+  deriveProps() {
+    return null;
+  }
+
+  draw({ canvas, paint }: DrawingContext) {
+    const { image, sprites, transforms, colors, blendMode } = this.props;
+    if (!image) {
+      return;
+    }
+    const defaultBlendMode = colors ? BlendMode.DstOver : BlendMode.SrcOver;
+    const blend = blendMode ? BlendMode[enumKey(blendMode)] : defaultBlendMode;
+    canvas.drawAtlas(image, sprites, transforms, paint, blend, colors);
+  }
+}
@@ -3,7 +3,7 @@ import { FillType } from "../../../skia/types";
 import type { SkPath } from "../../../skia/types";
 import type { DrawingContext, PathProps } from "../../types";
 import { NodeType } from "../../types";
-import { enumKey, processPath } from "../datatypes";
+import { enumKey, morphPath, processPath } from "../datatypes";
 import { JsiDrawingNode } from "../DrawingNode";
 import type { NodeContext } from "../Node";
 
@@ -18,6 +18,8 @@ export class PathNode extends JsiDrawingNode<PathProps, SkPath> {
       end: trimEnd,
       fillType,
       stroke,
+      morph,
+      progress,
       ...pathProps
     } = this.props;
     const start = saturate(trimStart);
@@ -28,7 +30,9 @@ export class PathNode extends JsiDrawingNode<PathProps, SkPath> {
     const hasFillType = !!fillType;
     const willMutatePath =
       hasStartOffset || hasEndOffset || hasStrokeOptions || hasFillType;
-    const pristinePath = processPath(this.Skia, pathProps.path);
+    const pristinePath = morph
+      ? morphPath(this.Skia, pathProps.path, morph, progress ?? 0)
+      : processPath(this.Skia, pathProps.path);
     const path = willMutatePath ? pristinePath.copy() : pristinePath;
     if (hasFillType) {
       path.setFillType(FillType[enumKey(fillType)]);
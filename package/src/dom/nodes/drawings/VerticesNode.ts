@@ -1,18 +1,29 @@
-import type { SkVertices } from "../../../skia/types";
-import { VertexMode, BlendMode } from "../../../skia/types";
+import type { SkVertexBuffer, SkVertices } from "../../../skia/types";
+import {
+  VertexMode,
+  BlendMode,
+  isVertexBuffer,
+} from "../../../skia/types";
 import type { DrawingContext, VerticesProps } from "../../types";
 import { NodeType } from "../../types";
 import { enumKey } from "../datatypes";
 import { JsiDrawingNode } from "../DrawingNode";
 import type { NodeContext } from "../Node";
 
-export class VerticesNode extends JsiDrawingNode<VerticesProps, SkVertices> {
+export class VerticesNode extends JsiDrawingNode<
+  VerticesProps,
+  SkVertices | SkVertexBuffer
+> {
   constructor(ctx: NodeContext, props: VerticesProps) {
     super(ctx, NodeType.Vertices, props);
   }
 
   protected deriveProps() {
     const { mode, vertices, textures, colors, indices } = this.props;
+    if (isVertexBuffer(vertices)) {
+      // Read by drawVertices, so that updates in place are drawn
+      return vertices;
+    }
     const vertexMode = mode ? VertexMode[enumKey(mode)] : VertexMode.Triangles;
     return this.Skia.MakeVertices(
       vertexMode,
@@ -24,8 +35,11 @@ export class VerticesNode extends JsiDrawingNode<VerticesProps, SkVertices> {
   }
 
   draw({ canvas, paint }: DrawingContext) {
-    const { colors, blendMode } = this.props;
-    const defaultBlendMode = colors ? BlendMode.DstOver : BlendMode.SrcOver;
+    const { vertices, colors, blendMode } = this.props;
+    const hasColors = isVertexBuffer(vertices)
+      ? vertices.colors !== null
+      : !!colors;
+    const defaultBlendMode = hasColors ? BlendMode.DstOver : BlendMode.SrcOver;
     const blend = blendMode ? BlendMode[enumKey(blendMode)] : defaultBlendMode;
     if (this.derived === undefined) {
       throw new Error("VerticesNode: vertices is undefined");
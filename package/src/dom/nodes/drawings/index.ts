@@ -9,6 +9,7 @@ export * from "./OvalNode";
 export * from "./LineNode";
 export * from "./PatchNode";
 export * from "./VerticesNode";
+export * from "./AtlasNode";
 export * from "./CustomDrawingNode";
 export * from "./Text";
 export * from "./PictureNode";
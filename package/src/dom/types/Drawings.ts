@@ -15,6 +15,7 @@ import type {
   SkSVG,
   SkPaint,
   SkRect,
+  SkVertexBuffer,
 } from "../../skia/types";
 
 import type {
@@ -46,6 +47,8 @@ export interface PathProps extends DrawingNodeProps {
   end: number;
   stroke?: StrokeOpts;
   fillType?: SkEnum<typeof FillType>;
+  morph?: PathDef[];
+  progress?: number;
 }
 
 export interface CustomDrawingNodeProps extends DrawingNodeProps {
@@ -83,13 +86,25 @@ export interface PatchProps extends DrawingNodeProps {
 
 export interface VerticesProps extends DrawingNodeProps {
   colors?: string[];
-  vertices: SkPoint[];
+  // A vertex buffer brings its own mode, colors, textures and indices
+  vertices: SkPoint[] | SkVertexBuffer;
   textures?: SkPoint[];
   mode: SkEnum<typeof VertexMode>;
   blendMode?: SkEnum<typeof BlendMode>;
   indices?: number[];
 }
 
+export interface AtlasProps extends DrawingNodeProps {
+  image: SkImage | null;
+  // [x, y, width, height] of each sprite in the image
+  sprites: Float32Array;
+  // [scos, ssin, tx, ty] RSXform of each sprite
+  transforms: Float32Array;
+  // [r, g, b, a] of each sprite
+  colors?: Float32Array;
+  blendMode?: SkEnum<typeof BlendMode>;
+}
+
 export interface ImageSVGProps extends DrawingNodeProps {
   svg: SkSVG | null;
   x?: number;
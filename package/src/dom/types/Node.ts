@@ -5,6 +5,7 @@ import type { DrawingContext } from "./DrawingContext";
 
 export interface Node<P> {
   type: NodeType;
+  nodeId: number;
 
   setProps(props: P): void;
   setProp<K extends keyof P>(name: K, v: P[K]): boolean;
@@ -61,6 +61,7 @@ export const enum NodeType {
   Line = "skLine",
   Patch = "skPatch",
   Vertices = "skVertices",
+  Atlas = "skAtlas",
   DiffRect = "skDiffRect",
   Text = "skText",
   TextPath = "skTextPath",
@@ -27,6 +27,7 @@ import type {
   RectProps,
   RoundedRectProps,
   VerticesProps,
+  AtlasProps,
   TextProps,
   DiffRectProps,
   TextPathProps,
@@ -86,6 +87,7 @@ export interface SkDOM {
   Rect(props: RectProps): DrawingNode<RectProps>;
   RRect(props: RoundedRectProps): DrawingNode<RoundedRectProps>;
   Vertices(props: VerticesProps): DrawingNode<VerticesProps>;
+  Atlas(props: AtlasProps): DrawingNode<AtlasProps>;
   Text(props: TextProps): DrawingNode<TextProps>;
   TextPath(props: TextPathProps): DrawingNode<TextPathProps>;
   TextBlob(props: TextBlobProps): DrawingNode<TextBlobProps>;
@@ -17,6 +17,7 @@ import type {
   RoundedRectProps,
   TextProps,
   VerticesProps,
+  AtlasProps,
   BlurMaskFilterProps,
   BlendImageFilterProps,
   BlurImageFilterProps,
@@ -184,6 +185,7 @@ declare global {
     PictureNode: (props: PictureProps) => RenderNode<PictureProps>;
     ImageSVGNode: (props: ImageSVGProps) => RenderNode<ImageSVGProps>;
     VerticesNode: (props: VerticesProps) => RenderNode<VerticesProps>;
+    AtlasNode: (props: AtlasProps) => RenderNode<AtlasProps>;
     TextNode: (prop: TextProps) => RenderNode<TextProps>;
     TextPathNode: (prop: TextPathProps) => RenderNode<TextPathProps>;
     TextBlobNode: (prop: TextBlobProps) => RenderNode<TextBlobProps>;
@@ -215,6 +217,7 @@ declare global {
       skRect: SkiaProps<RectProps>;
       skRRect: SkiaProps<RoundedRectProps>;
       skVertices: SkiaProps<VerticesProps>;
+      skAtlas: SkiaProps<AtlasProps>;
       skText: SkiaProps<TextProps>;
       skTextPath: SkiaProps<TextPathProps>;
       skTextBlob: SkiaProps<TextBlobProps>;
@@ -311,6 +314,8 @@ export const createNode = (
       return Sk.RRect(props);
     case NodeType.Vertices:
       return Sk.Vertices(props);
+    case NodeType.Atlas:
+      return Sk.Atlas(props);
     case NodeType.Text:
       return Sk.Text(props);
     case NodeType.TextPath:
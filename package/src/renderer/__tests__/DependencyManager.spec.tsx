@@ -6,6 +6,7 @@ import { NodeType } from "../../dom/types/NodeType";
 
 class TestNode<P> implements Node<P> {
   type = NodeType.Circle;
+  nodeId = 0;
   _children: TestNode<unknown>[] = [];
 
   constructor(public mgr: DependencyManager, public props: P) {}
@@ -74,6 +74,36 @@ describe("Path Examples", () => {
     processResult(surface, "snapshots/paths/poly.png");
   });
 
+  it("Should morph between two polygons", () => {
+    const { Skia, vec } = importSkia();
+    const r = size / 4;
+    const square = (inset: number) => {
+      const path = Skia.Path.Make();
+      path.addPoly(
+        [
+          vec(inset, inset),
+          vec(size - inset, inset),
+          vec(size - inset, size - inset),
+          vec(inset, size - inset),
+        ],
+        true
+      );
+      return path;
+    };
+    // Halfway between the two squares is the polygon of the previous test
+    const surface = drawOnNode(
+      <Path
+        path={square(r / 2)}
+        morph={[square((r * 3) / 2)]}
+        progress={0.5}
+        strokeWidth={4}
+        style="stroke"
+        color="lightblue"
+      />
+    );
+    processResult(surface, "snapshots/paths/poly.png");
+  });
+
   it("Should render the Skia logo with proper stroke joins and caps", () => {
     const { Skia } = importSkia();
     const path = Skia.Path.MakeFromSVGString(
@@ -1,7 +1,7 @@
 import React from "react";
 
 import { processResult } from "../../__tests__/setup";
-import { Group, Line, Points, Rect } from "../components";
+import { Atlas, Group, Line, Points, Rect } from "../components";
 import * as SkiaRenderer from "../index";
 
 import { center, drawOnNode, width, importSkia } from "./setup";
@@ -40,6 +40,21 @@ describe("Renderer", () => {
     );
     processResult(surface, "snapshots/drawings/lightblue-rect.png");
   });
+  it("Light blue rectangle from an atlas sprite", () => {
+    const { Skia } = importSkia();
+    const sprite = Skia.Surface.Make(size, size)!;
+    sprite.getCanvas().drawColor(Skia.Color("lightblue"));
+    const image = sprite.makeImageSnapshot();
+    const offset = (width - size) / 2;
+    const surface = drawOnNode(
+      <Atlas
+        image={image}
+        sprites={Float32Array.of(0, 0, size, size)}
+        transforms={Float32Array.of(1, 0, offset, offset)}
+      />
+    );
+    processResult(surface, "snapshots/drawings/lightblue-rect.png");
+  });
   it("Points", () => {
     const { vec } = importSkia();
     const c = { x: width / 2, y: size / 2 + 16 };
@@ -0,0 +1,109 @@
+import React from "react";
+
+import { itRunsE2eOnly } from "../../../__tests__/setup";
+import { Circle, Group, Rect } from "../../components";
+import { surface } from "../setup";
+
+describe("Hit testing", () => {
+  itRunsE2eOnly("Should hit the nodes under a point", async () => {
+    await surface.draw(
+      <>
+        <Rect x={0} y={0} width={64} height={64} color="cyan" />
+        <Circle cx={64} cy={64} r={32} color="magenta" />
+      </>
+    );
+    const rect = await surface.hitTest({ x: 16, y: 16 });
+    const circle = await surface.hitTest({ x: 80, y: 80 });
+    expect(rect.length).toBe(1);
+    expect(circle.length).toBe(1);
+    expect(rect[0]).not.toBe(circle[0]);
+    // Both nodes are hit where they overlap, topmost first
+    expect(await surface.hitTest({ x: 60, y: 60 })).toEqual([
+      circle[0],
+      rect[0],
+    ]);
+    // The corner of the circle's bounds is outside of its geometry
+    expect(await surface.hitTest({ x: 92, y: 92 })).toEqual([]);
+    expect(await surface.hitTest({ x: 200, y: 200 })).toEqual([]);
+  });
+
+  itRunsE2eOnly("Should hit the nodes intersecting a rect", async () => {
+    await surface.draw(
+      <>
+        <Rect x={0} y={0} width={32} height={32} color="cyan" />
+        <Rect x={64} y={0} width={32} height={32} color="magenta" />
+        <Rect x={128} y={0} width={32} height={32} color="yellow" />
+      </>
+    );
+    const hits = await surface.hitTest({ x: 16, y: 16, width: 64, height: 8 });
+    expect(hits.length).toBe(2);
+    expect(hits[0]).toBeGreaterThan(hits[1]);
+    expect(
+      await surface.hitTest({ x: 40, y: 40, width: 100, height: 100 })
+    ).toEqual([]);
+  });
+
+  itRunsE2eOnly("Should map the query through the transforms", async () => {
+    await surface.draw(
+      <Group transform={[{ translateX: 128 }]}>
+        <Group transform={[{ scale: 2 }]}>
+          <Rect x={0} y={0} width={32} height={32} color="cyan" />
+        </Group>
+      </Group>
+    );
+    expect((await surface.hitTest({ x: 180, y: 60 })).length).toBe(1);
+    expect(await surface.hitTest({ x: 16, y: 16 })).toEqual([]);
+    expect(await surface.hitTest({ x: 200, y: 16 })).toEqual([]);
+  });
+
+  itRunsE2eOnly("Should test the points against the clip", async () => {
+    await surface.draw(
+      <Group clip={{ x: 0, y: 0, width: 32, height: 32 }}>
+        <Rect x={0} y={0} width={128} height={128} color="cyan" />
+      </Group>
+    );
+    expect((await surface.hitTest({ x: 16, y: 16 })).length).toBe(1);
+    expect(await surface.hitTest({ x: 64, y: 64 })).toEqual([]);
+  });
+
+  itRunsE2eOnly(
+    "Should hit the nodes that are culled because they are offscreen",
+    async () => {
+      const { width } = surface;
+      await surface.draw(
+        <>
+          <Rect x={0} y={0} width={32} height={32} color="cyan" />
+          <Rect x={width + 32} y={0} width={32} height={32} color="cyan" />
+        </>
+      );
+      // Culled nodes are tested against the bounds of their last render
+      expect((await surface.hitTest({ x: width + 48, y: 16 })).length).toBe(
+        1
+      );
+    }
+  );
+
+  itRunsE2eOnly("Should hit the children of large groups", async () => {
+    // Groups with 32 children or more use a grid over their children
+    const cells = new Array(64).fill(0).map((_, i) => ({
+      x: (i % 8) * 32,
+      y: Math.floor(i / 8) * 32,
+    }));
+    await surface.draw(
+      <Group>
+        {cells.map(({ x, y }, i) => (
+          <Rect key={i} x={x + 4} y={y + 4} width={24} height={24} />
+        ))}
+      </Group>
+    );
+    const first = await surface.hitTest({ x: 16, y: 16 });
+    const last = await surface.hitTest({ x: 240, y: 240 });
+    expect(first.length).toBe(1);
+    expect(last.length).toBe(1);
+    expect(last[0]).toBeGreaterThan(first[0]);
+    expect(await surface.hitTest({ x: 2, y: 2 })).toEqual([]);
+    expect(
+      (await surface.hitTest({ x: 16, y: 16, width: 32, height: 32 })).length
+    ).toBe(4);
+  });
+});
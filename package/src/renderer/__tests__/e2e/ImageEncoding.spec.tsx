@@ -0,0 +1,175 @@
+import { surface } from "../setup";
+import { itRunsE2eOnly } from "../../../__tests__/setup";
+
+// Files written by the tests, in a directory the app can write to. The e2e
+// tests run on the iOS simulator, which can write to /tmp.
+const getTestFilePath = () =>
+  surface.OS === "android"
+    ? "/data/data/com.rnskia/cache/encoded.png"
+    : "/tmp/rnskia-encoded.png";
+
+// The evaluated functions use promise chains instead of async functions,
+// which the Javascript engine of the app might not support in eval()
+describe("Image Encoding", () => {
+  it("Should encode asynchronously like encodeToBytes()", async () => {
+    const result = await surface.eval((Skia) => {
+      const offscreen = Skia.Surface.MakeOffscreen(128, 64)!;
+      const paint = Skia.Paint();
+      paint.setColor(Skia.Color("cyan"));
+      offscreen.getCanvas().drawCircle(32, 32, 32, paint);
+      offscreen.flush();
+      const image = offscreen.makeImageSnapshot();
+      const sync = image.encodeToBytes();
+      return image.encodeAsync().then((bytes) => {
+        const decoded = Skia.Image.MakeImageFromEncoded(
+          Skia.Data.fromBytes(bytes!)
+        )!;
+        return {
+          signature: Array.from(bytes!.slice(0, 4)),
+          syncSignature: Array.from(sync.slice(0, 4)),
+          size: [decoded.width(), decoded.height()],
+        };
+      });
+    });
+    expect(result.signature).toEqual([0x89, 0x50, 0x4e, 0x47]);
+    expect(result.syncSignature).toEqual(result.signature);
+    expect(result.size).toEqual([128, 64]);
+  });
+
+  it("Should scale the image before encoding it", async () => {
+    const sizes = await surface.eval((Skia) => {
+      const offscreen = Skia.Surface.MakeOffscreen(128, 64)!;
+      offscreen.getCanvas().drawColor(Skia.Color("cyan"));
+      offscreen.flush();
+      const image = offscreen.makeImageSnapshot();
+      const options = [
+        { width: 64 },
+        { height: 16 },
+        { width: 32, height: 32 },
+      ];
+      return Promise.all(
+        options.map((option) =>
+          image.encodeAsync(option).then((bytes) => {
+            const decoded = Skia.Image.MakeImageFromEncoded(
+              Skia.Data.fromBytes(bytes!)
+            )!;
+            return [decoded.width(), decoded.height()];
+          })
+        )
+      );
+    });
+    // A missing dimension keeps the aspect ratio
+    expect(sizes).toEqual([
+      [64, 32],
+      [32, 16],
+      [32, 32],
+    ]);
+  });
+
+  it("Should encode JPEG with the quality clamped to its range", async () => {
+    const result = await surface.eval((Skia) => {
+      const offscreen = Skia.Surface.MakeOffscreen(128, 128)!;
+      const canvas = offscreen.getCanvas();
+      const paint = Skia.Paint();
+      for (let i = 0; i < 16; i++) {
+        paint.setColor(Skia.Color(i % 2 ? "cyan" : "magenta"));
+        const x = (i % 4) * 32 + 16;
+        const y = Math.floor(i / 4) * 32 + 16;
+        canvas.drawCircle(x, y, 16, paint);
+      }
+      offscreen.flush();
+      const image = offscreen.makeImageSnapshot();
+      // ImageFormat.JPEG
+      return Promise.all(
+        [0, 100, -20, 500].map((quality) =>
+          image.encodeAsync({ format: 3, quality })
+        )
+      ).then(([low, high, belowRange, aboveRange]) => ({
+        signature: Array.from(high!.slice(0, 2)),
+        low: low!.length,
+        high: high!.length,
+        belowRange: belowRange!.length,
+        aboveRange: aboveRange!.length,
+      }));
+    });
+    expect(result.signature).toEqual([0xff, 0xd8]);
+    expect(result.low).toBeLessThan(result.high);
+    expect(result.belowRange).toBe(result.low);
+    expect(result.aboveRange).toBe(result.high);
+  });
+
+  // Web only supports the format and the quality
+  itRunsE2eOnly("Should apply the PNG compression options", async () => {
+    const result = await surface.eval((Skia) => {
+      const offscreen = Skia.Surface.MakeOffscreen(128, 128)!;
+      const paint = Skia.Paint();
+      paint.setColor(Skia.Color("cyan"));
+      offscreen.getCanvas().drawCircle(64, 64, 64, paint);
+      offscreen.flush();
+      const image = offscreen.makeImageSnapshot();
+      // The last one only tries PngFilter.None
+      return Promise.all(
+        [
+          { zlibLevel: 0 },
+          { zlibLevel: 9 },
+          { zlibLevel: 20 },
+          { zlibLevel: 9, pngFilters: 0x08 },
+        ].map((options) => image.encodeAsync(options))
+      ).then(([stored, smallest, aboveRange, unfiltered]) => ({
+        stored: stored!.length,
+        smallest: smallest!.length,
+        aboveRange: aboveRange!.length,
+        unfiltered: unfiltered!.length,
+      }));
+    });
+    expect(result.smallest).toBeLessThan(result.stored);
+    expect(result.aboveRange).toBe(result.smallest);
+    expect(result.unfiltered).toBeGreaterThan(0);
+  });
+
+  it("Should throw on invalid PNG filters", async () => {
+    const result = await surface.eval((Skia) => {
+      const offscreen = Skia.Surface.MakeOffscreen(16, 16)!;
+      const image = offscreen.makeImageSnapshot();
+      // Unknown bits, negative, too large, fractional and not a number
+      return [0x01, -8, 0x100, 8.5, "All"].map((pngFilters) => {
+        try {
+          image.encodeAsync({ pngFilters: pngFilters as number });
+          return false;
+        } catch (e) {
+          return true;
+        }
+      });
+    });
+    expect(result).toEqual([true, true, true, true, true]);
+  });
+
+  // Web doesn't support encoding to files
+  itRunsE2eOnly("Should encode to a file", async () => {
+    const result = await surface.eval(
+      (Skia, ctx) => {
+        const offscreen = Skia.Surface.MakeOffscreen(64, 32)!;
+        offscreen.getCanvas().drawColor(Skia.Color("cyan"));
+        offscreen.flush();
+        const image = offscreen.makeImageSnapshot();
+        return Promise.all([
+          image.encodeToFileAsync(ctx.path, { width: 32 }),
+          image.encodeToFileAsync("/rnskia-missing-directory/encoded.png"),
+        ]).then(([written, missingDirectory]) =>
+          Skia.Data.fromURI(`file://${ctx.path}`).then((data) => {
+            const decoded = Skia.Image.MakeImageFromEncoded(data)!;
+            return {
+              written,
+              missingDirectory,
+              size: [decoded.width(), decoded.height()],
+            };
+          })
+        );
+      },
+      { path: getTestFilePath() }
+    );
+    expect(result.written).toBe(true);
+    expect(result.missingDirectory).toBe(false);
+    expect(result.size).toEqual([32, 16]);
+  });
+});
@@ -2,7 +2,11 @@ import React from "react";
 
 import { surface, importSkia } from "../setup";
 import { Fill, Group, Path, Rect } from "../../components";
-import { checkImage, docPath } from "../../../__tests__/setup";
+import {
+  checkImage,
+  docPath,
+  itRunsE2eOnly,
+} from "../../../__tests__/setup";
 import type { Skia } from "../../../skia/types";
 import { PaintStyle } from "../../../skia/types";
 
@@ -143,6 +147,20 @@ describe("Paths", () => {
     );
     checkImage(img, "snapshots/paths/pattern.png");
   });
+  itRunsE2eOnly("should cache the paths parsed from SVG strings", async () => {
+    const { before, after } = await surface.eval((Skia) => {
+      // Unique to this test so that the first lookup misses
+      const svg = `M 0 0 L ${Date.now()} 10 Z`;
+      const stats = Skia.Path.getCacheStats();
+      Skia.Path.MakeFromSVGString(svg);
+      Skia.Path.MakeFromSVGString(svg);
+      return { before: stats, after: Skia.Path.getCacheStats() };
+    });
+    expect(after.misses - before.misses).toBe(1);
+    expect(after.hits - before.hits).toBe(1);
+    expect(after.entries).toBeGreaterThan(0);
+    expect(after.bytes).toBeGreaterThan(0);
+  });
   it("should be possible to call dispose on a path", async () => {
     await surface.eval((Skia) => {
       const path = Skia.Path.Make();
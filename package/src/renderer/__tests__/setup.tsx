@@ -14,7 +14,13 @@ import { JsiSkApi } from "../../skia/web/JsiSkia";
 import type { Node } from "../../dom/nodes";
 import { JsiSkDOM } from "../../dom/nodes";
 import { Group } from "../components";
-import type { SkImage, SkFont, Skia } from "../../skia/types";
+import type {
+  SkImage,
+  SkFont,
+  Skia,
+  SkPoint,
+  SkRect,
+} from "../../skia/types";
 import { isPath } from "../../skia/types";
 import { E2E } from "../../__tests__/setup";
 import { SkiaRoot } from "../Reconciler";
@@ -266,11 +272,14 @@ const serializeNode = (node: Node<any>): SerializedNode => {
 type EvalContext = Record<string, any>;
 
 interface TestingSurface {
+  // The function can be async, the promise resolves with its result
   eval<Ctx extends EvalContext, R>(
-    fn: (Skia: Skia, ctx: Ctx) => R,
+    fn: (Skia: Skia, ctx: Ctx) => R | Promise<R>,
     ctx?: Ctx
   ): Promise<R>;
   draw(node: ReactNode): Promise<SkImage>;
+  // Hit tests the last drawing, returns the ids of the nodes that are hit
+  hitTest(query: SkPoint | SkRect): Promise<number[]>;
   width: number;
   height: number;
   fontSize: number;
@@ -284,7 +293,7 @@ class LocalSurface implements TestingSurface {
   readonly OS = "node";
 
   eval<Ctx extends EvalContext, R>(
-    fn: (Skia: Skia, ctx: Ctx) => R,
+    fn: (Skia: Skia, ctx: Ctx) => R | Promise<R>,
     ctx?: Ctx
   ): Promise<R> {
     return Promise.resolve(fn(global.SkiaApi, ctx ?? ({} as any)));
@@ -297,6 +306,12 @@ class LocalSurface implements TestingSurface {
     draw();
     return Promise.resolve(ckSurface.makeImageSnapshot());
   }
+
+  hitTest(_query: SkPoint | SkRect): Promise<number[]> {
+    return Promise.reject(
+      new Error("Hit testing is only available on the native DOM")
+    );
+  }
 }
 
 class RemoteSurface implements TestingSurface {
@@ -344,4 +359,16 @@ class RemoteSurface implements TestingSurface {
       this.client!.send(serialize(node));
     });
   }
+
+  hitTest(query: SkPoint | SkRect): Promise<number[]> {
+    return new Promise((resolve) => {
+      this.client.once("message", (raw: Buffer) => {
+        resolve(JSON.parse(raw.toString()));
+      });
+      const { x, y } = query;
+      const size =
+        "width" in query ? { width: query.width, height: query.height } : {};
+      this.client.send(JSON.stringify({ hitTest: { x, y, ...size } }));
+    });
+  }
 }
@@ -0,0 +1,8 @@
+import React from "react";
+
+import type { SkiaProps } from "../../processors";
+import type { AtlasProps } from "../../../dom/types";
+
+export const Atlas = (props: SkiaProps<AtlasProps>) => {
+  return <skAtlas {...props} />;
+};
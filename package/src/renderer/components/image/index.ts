@@ -1,3 +1,4 @@
 export * from "./Image";
 export * from "./ImageShader";
 export * from "./ImageSVG";
+export * from "./Atlas";
@@ -0,0 +1,78 @@
+import type { Skia } from "../types";
+
+import { setupSkia } from "./setup";
+
+const getContour = (Skia: Skia) => {
+  const path = Skia.Path.Make();
+  path.moveTo(10, 10).lineTo(110, 10).quadTo(160, 60, 110, 110);
+  const iter = Skia.ContourMeasureIter(path, false, 1);
+  return iter.next()!;
+};
+
+const expectPosTans = (
+  Skia: Skia,
+  values: Float32Array,
+  distances: number[]
+) => {
+  const contour = getContour(Skia);
+  expect(values.length).toBeGreaterThanOrEqual(distances.length * 4);
+  distances.forEach((distance, i) => {
+    const [position, tangent] = contour.getPosTan(distance);
+    expect(values[i * 4]).toBeCloseTo(position.x, 4);
+    expect(values[i * 4 + 1]).toBeCloseTo(position.y, 4);
+    expect(values[i * 4 + 2]).toBeCloseTo(tangent.x, 4);
+    expect(values[i * 4 + 3]).toBeCloseTo(tangent.y, 4);
+  });
+};
+
+describe("ContourMeasure", () => {
+  it("Should return the same values as getPosTan() for many distances", () => {
+    const { Skia } = setupSkia();
+    const contour = getContour(Skia);
+    const length = contour.length();
+    const distances = [0, 25, 50, 100, length / 2, length - 1, length];
+    expectPosTans(Skia, contour.getPosTans(distances), distances);
+    expectPosTans(
+      Skia,
+      contour.getPosTans(Float32Array.from(distances)),
+      distances
+    );
+  });
+
+  it("Should pin the distances like getPosTan()", () => {
+    const { Skia } = setupSkia();
+    const contour = getContour(Skia);
+    const distances = [-10, contour.length() + 10];
+    expectPosTans(Skia, contour.getPosTans(distances), distances);
+  });
+
+  it("Should sample evenly spaced distances", () => {
+    const { Skia } = setupSkia();
+    const contour = getContour(Skia);
+    const length = contour.length();
+    const values = contour.samplePosTans(5);
+    expect(values.length).toBe(20);
+    expectPosTans(Skia, values, [0, 1, 2, 3, 4].map((i) => (length * i) / 4));
+    // A single sample is the start of the contour
+    expectPosTans(Skia, contour.samplePosTans(1), [0]);
+  });
+
+  it("Should reuse the output array when it is large enough", () => {
+    const { Skia } = setupSkia();
+    const contour = getContour(Skia);
+    const output = new Float32Array(40);
+    expect(contour.samplePosTans(10, output)).toBe(output);
+    expect(contour.getPosTans([0, 10], output)).toBe(output);
+    const result = contour.samplePosTans(11, output);
+    expect(result).not.toBe(output);
+    expect(result.length).toBe(44);
+  });
+
+  it("Should reject invalid sample counts", () => {
+    const { Skia } = setupSkia();
+    const contour = getContour(Skia);
+    [0, -1, 1.5, NaN, Infinity, 2 ** 40].forEach((count) => {
+      expect(() => contour.samplePosTans(count)).toThrow();
+    });
+  });
+});
@@ -1,5 +1,5 @@
 import { processResult } from "../../__tests__/setup";
-import { BlendMode, PaintStyle, StrokeCap } from "../types";
+import { BlendMode, PaintStyle, PointMode, StrokeCap } from "../types";
 
 import { setupSkia } from "./setup";
 
@@ -116,4 +116,79 @@ describe("Drawings", () => {
     canvas.drawRect(rct, paint);
     processResult(surface, "snapshots/drawings/transparent.png");
   });
+
+  it("Lightblue rectangle from an atlas sprite", () => {
+    const { surface, canvas, Skia } = setupSkia();
+    const sprite = Skia.Surface.Make(128, 128)!;
+    sprite.getCanvas().drawColor(Skia.Color("lightblue"));
+    const image = sprite.makeImageSnapshot();
+    canvas.drawAtlas(
+      image,
+      Float32Array.of(0, 0, 128, 128),
+      Float32Array.of(1, 0, 64, 64),
+      Skia.Paint()
+    );
+    processResult(surface, "snapshots/drawings/small-lightblue-rect.png");
+  });
+
+  it("Atlas sprites are cleared with the clear blend mode", () => {
+    const { surface, canvas, Skia } = setupSkia(100, 100);
+    const sprite = Skia.Surface.Make(50, 50)!;
+    sprite.getCanvas().drawColor(Skia.Color("lightblue"));
+    const image = sprite.makeImageSnapshot();
+    canvas.drawAtlas(
+      image,
+      Float32Array.of(0, 0, 50, 50, 0, 0, 50, 50),
+      Float32Array.of(1, 0, 0, 0, 2, 0, 0, 0),
+      Skia.Paint(),
+      BlendMode.Clear,
+      Float32Array.of(1, 0, 0, 1, 0, 0, 1, 1)
+    );
+    processResult(surface, "snapshots/drawings/transparent.png");
+  });
+
+  it("Lightblue rectangle from two adjacent rects", () => {
+    const { surface, canvas, Skia } = setupSkia();
+    const paint = Skia.Paint();
+    paint.setColor(Skia.Color("lightblue"));
+    canvas.drawRects(Float32Array.of(64, 64, 128, 64, 64, 128, 128, 64), paint);
+    processResult(surface, "snapshots/drawings/small-lightblue-rect.png");
+  });
+
+  it("Cyan circle from a typed array", () => {
+    const { surface, canvas, Skia } = setupSkia();
+    const paint = Skia.Paint();
+    paint.setAntiAlias(true);
+    paint.setColor(Skia.Color("cyan"));
+    canvas.drawCircles(Float32Array.of(128, 128, 128), paint);
+    processResult(surface, "snapshots/drawings/cyan-circle.png");
+  });
+
+  it("Cyan line from a typed array", () => {
+    const { surface, canvas, width, height, Skia } = setupSkia();
+    const paint = Skia.Paint();
+    paint.setAntiAlias(true);
+    paint.setColor(Skia.Color("cyan"));
+    paint.setStyle(PaintStyle.Stroke);
+    paint.setStrokeWidth(10);
+    paint.setStrokeCap(StrokeCap.Round);
+    canvas.drawLines(Float32Array.of(32, 32, width - 32, height - 32), paint);
+    processResult(surface, "snapshots/drawings/line.png");
+  });
+
+  it("Cyan line from points in a typed array", () => {
+    const { surface, canvas, width, height, Skia } = setupSkia();
+    const paint = Skia.Paint();
+    paint.setAntiAlias(true);
+    paint.setColor(Skia.Color("cyan"));
+    paint.setStyle(PaintStyle.Stroke);
+    paint.setStrokeWidth(10);
+    paint.setStrokeCap(StrokeCap.Round);
+    canvas.drawPoints(
+      PointMode.Lines,
+      Float32Array.of(32, 32, width - 32, height - 32),
+      paint
+    );
+    processResult(surface, "snapshots/drawings/line.png");
+  });
 });
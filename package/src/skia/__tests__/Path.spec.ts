@@ -1,7 +1,13 @@
 /* eslint-disable max-len */
 import { interpolatePaths } from "../../animation/functions/interpolatePaths";
 import type { Skia, SkPath } from "../types";
-import { FillType, PathOp, PathVerb } from "../types";
+import {
+  FillType,
+  PathOp,
+  PathVerb,
+  StrokeCap,
+  StrokeJoin,
+} from "../types";
 import { processResult } from "../../__tests__/setup";
 import { PaintStyle } from "../types/Paint/Paint";
 
@@ -384,3 +390,114 @@ describe("Path", () => {
     path.dispose();
   });
 });
+
+describe("Path asynchronous operations", () => {
+  const makeCircle = (Skia: Skia, cx: number, cy = 128, r = 64) => {
+    const path = Skia.Path.Make();
+    path.addCircle(cx, cy, r);
+    return path;
+  };
+
+  it("dashAsync() should return the result of dash() in a new path", async () => {
+    const { Skia } = setupSkia();
+    const path = makeCircle(Skia, 128);
+    const source = path.toSVGString();
+    const expected = path.copy();
+    expect(expected.dash(10, 5, 2)).toBe(true);
+    const result = await path.dashAsync(10, 5, 2);
+    expect(result!.toSVGString()).toBe(expected.toSVGString());
+    expect(path.toSVGString()).toBe(source);
+  });
+
+  it("strokeAsync() should return the result of stroke() in a new path", async () => {
+    const { Skia } = setupSkia();
+    const path = makeCircle(Skia, 128);
+    const source = path.toSVGString();
+    const opts = { width: 10, join: StrokeJoin.Round, cap: StrokeCap.Round };
+    const expected = path.copy().stroke(opts);
+    const result = await path.strokeAsync(opts);
+    expect(result!.toSVGString()).toBe(expected!.toSVGString());
+    expect(path.toSVGString()).toBe(source);
+  });
+
+  it("trimAsync() should return the result of trim() in a new path", async () => {
+    const { Skia } = setupSkia();
+    const path = makeCircle(Skia, 128);
+    const source = path.toSVGString();
+    const expected = path.copy().trim(0.25, 0.75, false);
+    const result = await path.trimAsync(0.25, 0.75, false);
+    expect(result!.toSVGString()).toBe(expected!.toSVGString());
+    expect(path.toSVGString()).toBe(source);
+  });
+
+  it("simplifyAsync() should return the result of simplify() in a new path", async () => {
+    const { Skia } = setupSkia();
+    // Self intersecting
+    const path = Skia.Path.MakeFromSVGString("M0 0L100 100L100 0L0 100Z")!;
+    const source = path.toSVGString();
+    const expected = path.copy();
+    expect(expected.simplify()).toBe(true);
+    const result = await path.simplifyAsync();
+    expect(result!.toSVGString()).toBe(expected.toSVGString());
+    expect(path.toSVGString()).toBe(source);
+  });
+
+  it("opAsync() should return the result of op() in a new path", async () => {
+    const { Skia } = setupSkia();
+    const path = makeCircle(Skia, 96);
+    const other = makeCircle(Skia, 160);
+    const source = path.toSVGString();
+    const expected = path.copy();
+    expect(expected.op(other, PathOp.Difference)).toBe(true);
+    const result = await path.opAsync(other, PathOp.Difference);
+    expect(result!.toSVGString()).toBe(expected.toSVGString());
+    expect(path.toSVGString()).toBe(source);
+  });
+
+  it("MakeFromOpAsync() should return the result of MakeFromOp()", async () => {
+    const { Skia } = setupSkia();
+    const one = makeCircle(Skia, 96);
+    const two = makeCircle(Skia, 160);
+    const expected = Skia.Path.MakeFromOp(one, two, PathOp.XOR)!;
+    const result = await Skia.Path.MakeFromOpAsync(one, two, PathOp.XOR);
+    expect(result!.toSVGString()).toBe(expected.toSVGString());
+  });
+
+  it("MakeFromOpsAsync() should combine all paths in order", async () => {
+    const { Skia } = setupSkia();
+    const paths = [64, 128, 192].map((cx) => makeCircle(Skia, cx, 128, 48));
+    const expected = paths[0].copy();
+    expect(expected.op(paths[1], PathOp.Union)).toBe(true);
+    expect(expected.op(paths[2], PathOp.Union)).toBe(true);
+    const result = await Skia.Path.MakeFromOpsAsync(paths, PathOp.Union);
+    // The operations can be combined differently, the union is the same
+    const bounds = result!.getBounds();
+    const expectedBounds = expected.getBounds();
+    expect(bounds.x).toBeCloseTo(expectedBounds.x);
+    expect(bounds.y).toBeCloseTo(expectedBounds.y);
+    expect(bounds.width).toBeCloseTo(expectedBounds.width);
+    expect(bounds.height).toBeCloseTo(expectedBounds.height);
+    expect(result!.contains(128, 128)).toBe(true);
+    expect(result!.contains(128, 16)).toBe(false);
+  });
+
+  it("should resolve with null when the operation fails", async () => {
+    const { Skia } = setupSkia();
+    const path = makeCircle(Skia, 128);
+    // Dashes without length are invalid
+    expect(path.copy().dash(0, 0, 0)).toBe(false);
+    expect(await path.dashAsync(0, 0, 0)).toBeNull();
+    expect(await Skia.Path.MakeFromOpsAsync([], PathOp.Union)).toBeNull();
+  });
+
+  it("should throw like the synchronous operation for invalid arguments", () => {
+    const { Skia } = setupSkia();
+    const path = makeCircle(Skia, 128);
+    const invalid = null as unknown as SkPath;
+    expect(() => path.op(invalid, PathOp.Union)).toThrow();
+    expect(() => path.opAsync(invalid, PathOp.Union)).toThrow();
+    expect(() =>
+      Skia.Path.MakeFromOpAsync(path, invalid, PathOp.Union)
+    ).toThrow();
+  });
+});
@@ -37,4 +37,51 @@ describe("Vertices", () => {
     canvas.drawVertices(vert, BlendMode.DstOver, paint);
     processResult(surface, "snapshots/vertices/billinear-gradient.png");
   });
+
+  it("Billinear gradient from typed arrays", () => {
+    const { surface, canvas, width, Skia } = setupSkia();
+    const positions = Float32Array.of(0, 0, width, 0, width, width, 0, width);
+    const colors = Uint32Array.of(
+      0xff61dafb,
+      0xfffb61da,
+      0xffdafb61,
+      0xff61fbcf
+    );
+    const indices = Uint16Array.of(0, 1, 2, 0, 2, 3);
+    const paint = Skia.Paint();
+    paint.setColor(Skia.Color("purple"));
+    canvas.drawVertexBuffers(
+      VertexMode.Triangles,
+      positions,
+      null,
+      colors,
+      indices,
+      BlendMode.DstOver,
+      paint
+    );
+    processResult(surface, "snapshots/vertices/billinear-gradient.png");
+  });
+
+  it("Billinear gradient from the arrays of a vertex buffer", () => {
+    const { surface, canvas, width, Skia } = setupSkia();
+    const buffer = Skia.MakeVertexBuffer(VertexMode.Triangles, 4, {
+      colors: true,
+      indexCount: 6,
+    });
+    buffer.positions.set([0, 0, width, 0, width, width, 0, width]);
+    buffer.colors!.set([0xff61dafb, 0xfffb61da, 0xffdafb61, 0xff61fbcf]);
+    buffer.indices!.set([0, 1, 2, 0, 2, 3]);
+    const paint = Skia.Paint();
+    paint.setColor(Skia.Color("purple"));
+    canvas.drawVertexBuffers(
+      buffer.mode,
+      buffer.positions,
+      buffer.textures,
+      buffer.colors,
+      buffer.indices,
+      BlendMode.DstOver,
+      paint
+    );
+    processResult(surface, "snapshots/vertices/billinear-gradient.png");
+  });
 });
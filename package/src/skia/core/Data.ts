@@ -1,9 +1,9 @@
-import { useEffect, useRef, useState } from "react";
-
 import { Skia } from "../Skia";
 import type { SkData, DataSourceParam, SkJSIInstance } from "../types";
 import { Platform } from "../../Platform";
 
+import { useLoading } from "./Loading";
+
 const factoryWrapper = <T>(
   data2: SkData,
   factory: (data: SkData) => T,
@@ -37,29 +37,6 @@ const loadData = <T>(
     );
   }
 };
-const useLoading = <T extends SkJSIInstance<string>>(
-  source: DataSourceParam,
-  loader: () => Promise<T | null>
-) => {
-  const mounted = useRef(false);
-  const [data, setData] = useState<T | null>(null);
-  const dataRef = useRef<T | null>(null);
-  useEffect(() => {
-    mounted.current = true;
-    loader().then((value) => {
-      if (mounted.current) {
-        setData(value);
-        dataRef.current = value;
-      }
-    });
-    return () => {
-      dataRef.current?.dispose();
-      mounted.current = false;
-    };
-    // eslint-disable-next-line react-hooks/exhaustive-deps
-  }, [source]);
-  return data;
-};
 
 export const useRawData = <T extends SkJSIInstance<string>>(
   source: DataSourceParam,
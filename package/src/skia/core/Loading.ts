@@ -0,0 +1,29 @@
+import { useEffect, useRef, useState } from "react";
+
+import type { DataSourceParam, SkJSIInstance } from "../types";
+
+// Not re-exported from ./index, the hook is shared by the loaders in this
+// folder only.
+export const useLoading = <T extends SkJSIInstance<string>>(
+  source: DataSourceParam,
+  loader: () => Promise<T | null>
+) => {
+  const mounted = useRef(false);
+  const [data, setData] = useState<T | null>(null);
+  const dataRef = useRef<T | null>(null);
+  useEffect(() => {
+    mounted.current = true;
+    loader().then((value) => {
+      if (mounted.current) {
+        setData(value);
+        dataRef.current = value;
+      }
+    });
+    return () => {
+      dataRef.current?.dispose();
+      mounted.current = false;
+    };
+    // eslint-disable-next-line react-hooks/exhaustive-deps
+  }, [source]);
+  return data;
+};
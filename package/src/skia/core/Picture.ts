@@ -1,5 +1,13 @@
 import { Skia } from "../Skia";
-import type { SkCanvas, SkRect } from "../types";
+import type {
+  DataSourceParam,
+  SkCanvas,
+  SkPicture,
+  SkRect,
+} from "../types";
+import { Platform } from "../../Platform";
+
+import { useLoading } from "./Loading";
 
 /**
  * Memoizes and returns an SkPicture that can be drawn to another canvas.
@@ -13,3 +21,36 @@ export const createPicture = (rect: SkRect, cb: (canvas: SkCanvas) => void) => {
   cb(canvas);
   return recorder.finishRecordingAsPicture();
 };
+
+const loadPicture = (
+  source: DataSourceParam,
+  onError?: (err: Error) => void
+): Promise<SkPicture | null> => {
+  let picture: Promise<SkPicture | null>;
+  if (source === null || source === undefined) {
+    return Promise.resolve(null);
+  } else if (source instanceof Uint8Array) {
+    picture = Promise.resolve(Skia.Picture.MakePicture(source) ?? null);
+  } else {
+    const uri =
+      typeof source === "string" ? source : Platform.resolveAsset(source);
+    picture = Skia.Picture.MakePictureFromURI(uri);
+  }
+  return picture.then((result) => {
+    if (result === null) {
+      onError && onError(new Error("Could not load picture"));
+    }
+    return result;
+  });
+};
+
+/**
+ * Loads a serialized picture (.skp) from a bundled asset, a uri or bytes.
+ * @param source
+ * @param onError Called if the picture could not be loaded
+ * @returns SkPicture or null while loading
+ */
+export const usePicture = (
+  source: DataSourceParam,
+  onError?: (err: Error) => void
+) => useLoading(source, () => loadPicture(source, onError));
@@ -10,7 +10,7 @@ import type { BlendMode } from "./Paint/BlendMode";
 import type { SkPoint, PointMode } from "./Point";
 import type { SkMatrix } from "./Matrix";
 import type { SkImageFilter } from "./ImageFilter";
-import type { SkVertices } from "./Vertices";
+import type { SkVertexBuffer, SkVertices, VertexMode } from "./Vertices";
 import type { SkTextBlob } from "./TextBlob";
 import type { SkPicture } from "./Picture";
 
@@ -205,11 +205,17 @@ export interface SkCanvas {
    *  is mapped using the vertices' positions.
    *  If vertices colors are defined in vertices, and Paint paint contains Shader,
    *  BlendMode mode combines vertices colors with Shader.
+   *  A vertex buffer is read when it is drawn, so it can be updated in place
+   *  between draws.
    * @param verts
    * @param mode
    * @param paint
    */
-  drawVertices(verts: SkVertices, mode: BlendMode, paint: SkPaint): void;
+  drawVertices(
+    verts: SkVertices | SkVertexBuffer,
+    mode: BlendMode,
+    paint: SkPaint
+  ): void;
 
   /**
    * Draws a cubic patch defined by 12 control points [top, right, bottom, left] with optional
@@ -238,11 +244,84 @@ export interface SkCanvas {
    * Draws the given points using the current clip, current matrix, and the provided paint.
    *
    * See Canvas.h for more on the mode and its interaction with paint.
+   * Points can also be given as a flat Float32Array of [x0, y0, x1, y1, ...]
+   * coordinates which is read without converting each point.
    * @param mode
    * @param points
    * @param paint
    */
-  drawPoints(mode: PointMode, points: SkPoint[], paint: SkPaint): void;
+  drawPoints(
+    mode: PointMode,
+    points: SkPoint[] | Float32Array,
+    paint: SkPaint
+  ): void;
+
+  /**
+   * Draws line segments from a flat Float32Array of
+   * [x0, y0, x1, y1, ...] coordinates, each pair of points being one line.
+   * @param lines
+   * @param paint
+   */
+  drawLines(lines: Float32Array, paint: SkPaint): void;
+
+  /**
+   * Draws rectangles from a flat Float32Array of [x, y, width, height, ...]
+   * values using the same paint.
+   * @param rects
+   * @param paint
+   */
+  drawRects(rects: Float32Array, paint: SkPaint): void;
+
+  /**
+   * Draws circles from a flat Float32Array of [cx, cy, radius, ...] values
+   * using the same paint.
+   * @param circles
+   * @param paint
+   */
+  drawCircles(circles: Float32Array, paint: SkPaint): void;
+
+  /**
+   * Draws sprites from an atlas image. Each sprite is a sub-rectangle of the
+   * atlas given as [x, y, width, height] in sprites and placed with the
+   * corresponding [scos, ssin, tx, ty] RSXform in transforms.
+   * @param atlas
+   * @param sprites flat Float32Array of source rectangles
+   * @param transforms flat Float32Array of RSXforms
+   * @param paint
+   * @param blendMode how the colors are combined with the atlas, defaults to SrcOver
+   * @param colors optional flat Float32Array of [r, g, b, a] per sprite
+   */
+  drawAtlas(
+    atlas: SkImage,
+    sprites: Float32Array,
+    transforms: Float32Array,
+    paint: SkPaint,
+    blendMode?: BlendMode | null,
+    colors?: Float32Array | null
+  ): void;
+
+  /**
+   * Draws a triangle mesh directly from typed arrays, without creating an
+   * SkVertices object first. The arrays are laid out like the ones of a
+   * SkVertexBuffer.
+   * @param mode
+   * @param positions flat Float32Array of [x, y] vertex positions
+   * @param textureCoordinates optional flat Float32Array of [x, y] per vertex
+   * @param colors optional Uint32Array of 32-bit ARGB colors (0xAARRGGBB),
+   * one per vertex
+   * @param indices optional Uint16Array of vertex indices
+   * @param blendMode
+   * @param paint
+   */
+  drawVertexBuffers(
+    mode: VertexMode,
+    positions: Float32Array,
+    textureCoordinates: Float32Array | null,
+    colors: Uint32Array | null,
+    indices: Uint16Array | null,
+    blendMode: BlendMode,
+    paint: SkPaint
+  ): void;
 
   /** Draws arc using clip, SkMatrix, and SkPaint paint.
 
@@ -17,6 +17,25 @@ export interface SkContourMeasure extends SkJSIInstance<"ContourMeasure"> {
    */
   getPosTan(distance: number): [position: SkPoint, tangent: SkPoint];
 
+  /**
+   * Returns the positions and tangents for many distances in a single call,
+   * as [px, py, tx, ty] for each distance.
+   * @param distances - will each be pinned between 0 and length().
+   * @param output - array to write to, reused when it has room for all values.
+   */
+  getPosTans(
+    distances: number[] | Float32Array,
+    output?: Float32Array
+  ): Float32Array;
+
+  /**
+   * Returns the positions and tangents at count evenly spaced distances from
+   * the start to the end of the contour, as [px, py, tx, ty] for each distance.
+   * @param count - number of samples, a whole number of at least 1.
+   * @param output - array to write to, reused when it has room for all values.
+   */
+  samplePosTans(count: number, output?: Float32Array): Float32Array;
+
   /**
    * Returns an Path representing the segment of this contour.
    * @param startD - will be pinned between 0 and length()
@@ -20,6 +20,46 @@ export enum ImageFormat {
   WEBP = 6,
 }
 
+/**
+ * Row filters tried by the PNG encoder, can be combined with `|`.
+ */
+export enum PngFilter {
+  None = 0x08,
+  Sub = 0x10,
+  Up = 0x20,
+  Avg = 0x40,
+  Paeth = 0x80,
+  All = None | Sub | Up | Avg | Paeth,
+}
+
+export interface ImageEncodeOptions {
+  /** PNG is the default value. */
+  format?: ImageFormat;
+  /**
+   * JPEG and WebP quality, a value from 0 to 100; 100 is the least lossy.
+   * Values outside of the range are clamped.
+   */
+  quality?: number;
+  /** Encodes WebP images without loss, quality is then the effort. */
+  lossless?: boolean;
+  /**
+   * PNG compression level, from 0 (fastest) to 9 (smallest), values outside
+   * of the range are clamped. Default is 6.
+   */
+  zlibLevel?: number;
+  /**
+   * PNG row filters to try, PngFilter.All is the default value. Encoding
+   * throws if other bits are set.
+   */
+  pngFilters?: PngFilter;
+  /**
+   * Size to scale the image to before encoding. When only one of width and
+   * height is set, the other one keeps the aspect ratio of the image.
+   */
+  width?: number;
+  height?: number;
+}
+
 export interface SkImage extends SkJSIInstance<"Image"> {
   /**
    * Returns the possibly scaled height of the image.
@@ -94,6 +134,29 @@ export interface SkImage extends SkJSIInstance<"Image"> {
   */
   encodeToBase64(fmt?: ImageFormat, quality?: number): string;
 
+  /**
+   * Encodes the image pixels on a background thread, scaling them first if
+   * the options have a size. Images backed by a GPU texture are read back
+   * before the promise is created.
+   *
+   * @return Promise resolving to the encoded data, or null if encoding fails
+   */
+  encodeAsync(options?: ImageEncodeOptions): Promise<Uint8Array | null>;
+
+  /**
+   * Encodes the image pixels on a background thread and writes them to the
+   * file while encoding, without keeping the encoded data in memory.
+   * Not supported on React Native Web.
+   *
+   * @param path - Path or file:// uri of the file to write
+   * @return Promise resolving to true if the file was written, on failure no
+   * file is left at the path
+   */
+  encodeToFileAsync(
+    path: string,
+    options?: ImageEncodeOptions
+  ): Promise<boolean>;
+
   /**
    * Returns raster image or lazy image. Copies SkImage backed by GPU texture
    * into CPU memory if needed. Returns original SkImage if decoded in raster
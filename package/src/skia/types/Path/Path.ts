@@ -233,6 +233,13 @@ export interface SkPath extends SkJSIInstance<"Path"> {
    */
   stroke(opts?: StrokeOpts): null | SkPath;
 
+  /**
+   * Same as stroke(), but computed on a background thread. Resolves with a
+   * new path, or null if the operation fails. This path is not modified.
+   * @param opts - describe how stroked path should look.
+   */
+  strokeAsync(opts?: StrokeOpts): Promise<SkPath | null>;
+
   /**
    * Appends CLOSE_VERB to Path. A closed contour connects the first and last point
    * with a line, forming a continuous loop.
@@ -385,6 +392,15 @@ export interface SkPath extends SkJSIInstance<"Path"> {
    */
   dash(on: number, off: number, phase: number): boolean;
 
+  /**
+   * Same as dash(), but computed on a background thread. Resolves with a new
+   * path, or null if the operation fails. This path is not modified.
+   * @param on
+   * @param off
+   * @param phase
+   */
+  dashAsync(on: number, off: number, phase: number): Promise<SkPath | null>;
+
   /**
    * Returns true if other path is equal to this path.
    * @param other
@@ -507,6 +523,14 @@ export interface SkPath extends SkJSIInstance<"Path"> {
     */
   op(path: SkPath, op: PathOp): boolean;
 
+  /**
+   * Same as op(), but computed on a background thread. Resolves with a new
+   * path, or null if the operation fails. Neither path is modified.
+   * @param path The second path (for difference, the subtrahend)
+   * @param op The operator to apply.
+   */
+  opAsync(path: SkPath, op: PathOp): Promise<SkPath | null>;
+
   /** Set this path to a set of non-overlapping contours that describe the
     same area as the original path.
     The curve order is reduced where possible so that cubics may
@@ -520,6 +544,12 @@ export interface SkPath extends SkJSIInstance<"Path"> {
   */
   simplify(): boolean;
 
+  /**
+   * Same as simplify(), but computed on a background thread. Resolves with a
+   * new path, or null if the operation fails. This path is not modified.
+   */
+  simplifyAsync(): Promise<SkPath | null>;
+
   /**
    * Returns this path as an SVG string.
    */
@@ -537,6 +567,19 @@ export interface SkPath extends SkJSIInstance<"Path"> {
    */
   trim(startT: number, stopT: number, isComplement: boolean): null | SkPath;
 
+  /**
+   * Same as trim(), but computed on a background thread. Resolves with a new
+   * path, or null if the operation fails. This path is not modified.
+   * @param startT - a value in the range [0.0, 1.0]. 0.0 is the beginning of the path.
+   * @param stopT  - a value in the range [0.0, 1.0]. 1.0 is the end of the path.
+   * @param isComplement
+   */
+  trimAsync(
+    startT: number,
+    stopT: number,
+    isComplement: boolean
+  ): Promise<SkPath | null>;
+
   /**
    * Transforms the path by the specified matrix.
    */
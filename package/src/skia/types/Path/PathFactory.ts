@@ -2,6 +2,17 @@ import type { SkFont } from "../Font";
 
 import type { SkPath, PathOp, PathCommand } from "./Path";
 
+export interface PathCacheStats {
+  /** Paths from SVG strings that were found in the cache */
+  hits: number;
+  /** Paths from SVG strings that had to be parsed */
+  misses: number;
+  /** Number of cached paths */
+  entries: number;
+  /** Approximate memory used by the cached paths and their strings */
+  bytes: number;
+}
+
 export interface PathFactory {
   Make(): SkPath;
   /**
@@ -20,6 +31,30 @@ export interface PathFactory {
    */
   MakeFromOp(one: SkPath, two: SkPath, op: PathOp): SkPath | null;
 
+  /**
+   * Same as MakeFromOp(), but computed on a background thread. The promise
+   * resolves with null if this fails.
+   * @param one
+   * @param two
+   * @param op
+   */
+  MakeFromOpAsync(
+    one: SkPath,
+    two: SkPath,
+    op: PathOp
+  ): Promise<SkPath | null>;
+
+  /**
+   * Creates a new path by combining all given paths in order according to op
+   * ((paths[0] op paths[1]) op paths[2]...), in a single task on a background
+   * thread. This is much faster than combining the paths one by one, like
+   * when computing the union of many shapes. The promise resolves with null if
+   * this fails.
+   * @param paths
+   * @param op
+   */
+  MakeFromOpsAsync(paths: SkPath[], op: PathOp): Promise<SkPath | null>;
+
   /**
    * Creates a new path from the given list of path commands. If this fails, null will be
    * returned instead.
@@ -31,4 +66,11 @@ export interface PathFactory {
    * Converts the text to a path with the given font at location x / y.
    */
   MakeFromText(text: string, x: number, y: number, font: SkFont): SkPath | null;
+
+  /**
+   * Returns statistics of the cache of the paths parsed from SVG strings, by
+   * MakeFromSVGString() and by the path prop of the Path component. Paths
+   * aren't cached on Web, where all statistics are 0.
+   */
+  getCacheStats(): PathCacheStats;
 }
@@ -6,4 +6,13 @@ export interface PictureFactory {
    * @param bytes
    */
   MakePicture(bytes: Uint8Array | ArrayBuffer): SkPicture | null;
+
+  /**
+   * Loads a serialized picture (.skp) from a file path, a bundled asset or a
+   * remote uri, without passing the bytes through JS. Local files are memory
+   * mapped and pictures with the same contents are only deserialized once.
+   * Resolves to null if the picture could not be loaded.
+   * @param uri
+   */
+  MakePictureFromURI(uri: string): Promise<SkPicture | null>;
 }
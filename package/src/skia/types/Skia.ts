@@ -17,7 +17,12 @@ import type { ShaderFactory } from "./Shader";
 import type { SkMatrix } from "./Matrix";
 import type { PathEffectFactory } from "./PathEffect";
 import type { SkPoint } from "./Point";
-import type { SkVertices, VertexMode } from "./Vertices/Vertices";
+import type {
+  SkVertexBuffer,
+  SkVertices,
+  VertexBufferOptions,
+  VertexMode,
+} from "./Vertices/Vertices";
 import type { DataFactory } from "./Data";
 import type { SVGFactory } from "./SVG";
 import type { TextBlobFactory } from "./TextBlob";
@@ -74,6 +79,18 @@ export interface Skia {
     indices?: number[] | null,
     isVolatile?: boolean
   ): SkVertices;
+  /**
+   * Returns a vertex buffer with arrays for the given number of vertices, to
+   * be filled and updated in place and drawn with drawVertices.
+   * @param mode
+   * @param vertexCount
+   * @param options - which optional arrays to allocate.
+   */
+  MakeVertexBuffer(
+    mode: VertexMode,
+    vertexCount: number,
+    options?: VertexBufferOptions
+  ): SkVertexBuffer;
   Data: DataFactory;
   Image: ImageFactory;
   SVG: SVGFactory;
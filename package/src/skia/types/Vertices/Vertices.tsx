@@ -7,6 +7,10 @@ export enum VertexMode {
   TriangleFan,
 }
 
+export const isVertexBuffer = (
+  obj: SkJSIInstance<string> | null
+): obj is SkVertexBuffer => obj !== null && obj.__typename__ === "VertexBuffer";
+
 export interface SkVertices extends SkJSIInstance<"Vertices"> {
   /**
    * Return the bounding area for the vertices.
@@ -18,3 +22,61 @@ export interface SkVertices extends SkJSIInstance<"Vertices"> {
    */
   uniqueID(): number;
 }
+
+export interface VertexBufferOptions {
+  /**
+   * Allocate texture coordinates, defaults to false.
+   */
+  textures?: boolean;
+
+  /**
+   * Allocate per-vertex colors, defaults to false.
+   */
+  colors?: boolean;
+
+  /**
+   * Number of indices to allocate, defaults to 0 (no indices).
+   */
+  indexCount?: number;
+}
+
+/**
+ * Vertices whose data can be updated in place, for instance once per frame.
+ * The arrays keep their size. Drawing the buffer on a canvas reads the arrays
+ * as they are, while the Vertices component draws what was last committed.
+ */
+export interface SkVertexBuffer extends SkJSIInstance<"VertexBuffer"> {
+  /**
+   * x, y pairs for each vertex.
+   */
+  readonly positions: Float32Array;
+
+  /**
+   * x, y pairs for each vertex, or null if no textures were allocated.
+   */
+  readonly textures: Float32Array | null;
+
+  /**
+   * One 32-bit ARGB color (0xAARRGGBB) for each vertex, or null if no colors
+   * were allocated.
+   */
+  readonly colors: Uint32Array | null;
+
+  /**
+   * Indices of the vertices to draw, or null if no indices were allocated.
+   */
+  readonly indices: Uint16Array | null;
+
+  readonly mode: VertexMode;
+
+  /**
+   * Return the bounding area for the current positions.
+   */
+  bounds(): SkRect;
+
+  /**
+   * Copies the current contents of the arrays for the Vertices components
+   * drawing this buffer, and redraws them. Call it after updating the arrays.
+   */
+  commit(): void;
+}
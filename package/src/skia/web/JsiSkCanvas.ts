@@ -21,8 +21,11 @@ import type {
   SkRRect,
   SkSVG,
   SkTextBlob,
+  SkVertexBuffer,
   SkVertices,
+  VertexMode,
 } from "../types";
+import { isVertexBuffer } from "../types";
 
 import { ckEnum, HostObject } from "./Host";
 import { JsiSkPaint } from "./JsiSkPaint";
@@ -30,6 +33,7 @@ import { JsiSkRect } from "./JsiSkRect";
 import { JsiSkRRect } from "./JsiSkRRect";
 import { JsiSkImage } from "./JsiSkImage";
 import { JsiSkVertices } from "./JsiSkVertices";
+import type { JsiSkVertexBuffer } from "./JsiSkVertexBuffer";
 import { JsiSkPath } from "./JsiSkPath";
 import { JsiSkFont } from "./JsiSkFont";
 import { JsiSkTextBlob } from "./JsiSkTextBlob";
@@ -182,7 +186,21 @@ export class JsiSkCanvas
     this.ref.drawCircle(cx, cy, radius, JsiSkPaint.fromValue(paint));
   }
 
-  drawVertices(verts: SkVertices, mode: BlendMode, paint: SkPaint) {
+  drawVertices(
+    verts: SkVertices | SkVertexBuffer,
+    mode: BlendMode,
+    paint: SkPaint
+  ) {
+    if (isVertexBuffer(verts)) {
+      const vertices = (verts as JsiSkVertexBuffer).makeVertices();
+      this.ref.drawVertices(
+        vertices,
+        ckEnum(mode),
+        JsiSkPaint.fromValue(paint)
+      );
+      vertices.delete();
+      return;
+    }
     this.ref.drawVertices(
       JsiSkVertices.fromValue(verts),
       ckEnum(mode),
@@ -210,12 +228,107 @@ export class JsiSkCanvas
     this.ref.restoreToCount(saveCount);
   }
 
-  drawPoints(mode: PointMode, points: SkPoint[], paint: SkPaint) {
+  drawPoints(
+    mode: PointMode,
+    points: SkPoint[] | Float32Array,
+    paint: SkPaint
+  ) {
     this.ref.drawPoints(
       ckEnum(mode),
-      points.map(({ x, y }) => [x, y]).flat(),
+      points instanceof Float32Array
+        ? points
+        : points.map(({ x, y }) => [x, y]).flat(),
+      JsiSkPaint.fromValue(paint)
+    );
+  }
+
+  drawLines(lines: Float32Array, paint: SkPaint) {
+    this.ref.drawPoints(
+      this.CanvasKit.PointMode.Lines,
+      lines,
+      JsiSkPaint.fromValue(paint)
+    );
+  }
+
+  drawRects(rects: Float32Array, paint: SkPaint) {
+    const p = JsiSkPaint.fromValue(paint);
+    for (let i = 0; i + 3 < rects.length; i += 4) {
+      const rect = this.CanvasKit.XYWHRect(
+        rects[i],
+        rects[i + 1],
+        rects[i + 2],
+        rects[i + 3]
+      );
+      this.ref.drawRect(rect, p);
+    }
+  }
+
+  drawCircles(circles: Float32Array, paint: SkPaint) {
+    const p = JsiSkPaint.fromValue(paint);
+    for (let i = 0; i + 2 < circles.length; i += 3) {
+      this.ref.drawCircle(circles[i], circles[i + 1], circles[i + 2], p);
+    }
+  }
+
+  drawAtlas(
+    atlas: SkImage,
+    sprites: Float32Array,
+    transforms: Float32Array,
+    paint: SkPaint,
+    blendMode?: BlendMode | null,
+    colors?: Float32Array | null
+  ) {
+    const count = Math.floor(Math.min(sprites.length, transforms.length) / 4);
+    const src = new Float32Array(count * 4);
+    for (let i = 0; i < count * 4; i += 4) {
+      src[i] = sprites[i];
+      src[i + 1] = sprites[i + 1];
+      src[i + 2] = sprites[i] + sprites[i + 2];
+      src[i + 3] = sprites[i + 1] + sprites[i + 3];
+    }
+    this.ref.drawAtlas(
+      JsiSkImage.fromValue(atlas),
+      src,
+      transforms.subarray(0, count * 4),
+      JsiSkPaint.fromValue(paint),
+      blendMode !== undefined && blendMode !== null
+        ? ckEnum(blendMode)
+        : undefined,
+      colors
+        ? Uint32Array.from({ length: count }, (_, i) =>
+            this.CanvasKit.ColorAsInt(
+              colors[i * 4] * 255,
+              colors[i * 4 + 1] * 255,
+              colors[i * 4 + 2] * 255,
+              colors[i * 4 + 3] * 255
+            )
+          )
+        : undefined
+    );
+  }
+
+  drawVertexBuffers(
+    mode: VertexMode,
+    positions: Float32Array,
+    textureCoordinates: Float32Array | null,
+    colors: Uint32Array | null,
+    indices: Uint16Array | null,
+    blendMode: BlendMode,
+    paint: SkPaint
+  ) {
+    const vertices = this.CanvasKit.MakeVertices(
+      ckEnum(mode),
+      positions,
+      textureCoordinates,
+      colors,
+      indices ? Array.from(indices) : null
+    );
+    this.ref.drawVertices(
+      vertices,
+      ckEnum(blendMode),
       JsiSkPaint.fromValue(paint)
     );
+    vertices.delete();
   }
 
   drawArc(
@@ -6,6 +6,9 @@ import { HostObject } from "./Host";
 import { JsiSkPath } from "./JsiSkPath";
 import { JsiSkPoint } from "./JsiSkPoint";
 
+// Keeps the result within the maximum length of a Float32Array
+const MaxSamples = 2 ** 31 / 4;
+
 export class JsiSkContourMeasure
   extends HostObject<ContourMeasure, "ContourMeasure">
   implements SkContourMeasure
@@ -22,6 +25,32 @@ export class JsiSkContourMeasure
     ];
   }
 
+  getPosTans(distances: number[] | Float32Array, output?: Float32Array) {
+    const result =
+      output && output.length >= distances.length * 4
+        ? output
+        : new Float32Array(distances.length * 4);
+    for (let i = 0; i < distances.length; i++) {
+      result.set(this.ref.getPosTan(distances[i]), i * 4);
+    }
+    return result;
+  }
+
+  samplePosTans(count: number, output?: Float32Array) {
+    if (!Number.isInteger(count) || count < 1 || count > MaxSamples) {
+      throw new Error(
+        "samplePosTans() expects a whole number of samples of at least 1"
+      );
+    }
+    const length = this.ref.length();
+    const step = count > 1 ? length / (count - 1) : 0;
+    const distances = new Float32Array(count);
+    for (let i = 0; i < count; i++) {
+      distances[i] = step * i;
+    }
+    return this.getPosTans(distances, output);
+  }
+
   getSegment(startD: number, stopD: number, startWithMoveTo: boolean) {
     return new JsiSkPath(
       this.CanvasKit,
@@ -1,7 +1,7 @@
 import type { CanvasKit, Image } from "canvaskit-wasm";
 
 import type {
-  ImageFormat,
+  ImageEncodeOptions,
   FilterMode,
   MipmapMode,
   SkImage,
@@ -9,8 +9,9 @@ import type {
   SkShader,
   TileMode,
 } from "../types";
+import { ImageFormat, PngFilter } from "../types";
 
-import { ckEnum, HostObject } from "./Host";
+import { ckEnum, HostObject, NotImplementedOnRNWeb } from "./Host";
 import { JsiSkMatrix } from "./JsiSkMatrix";
 import { JsiSkShader } from "./JsiSkShader";
 
@@ -110,6 +111,57 @@ export class JsiSkImage extends HostObject<Image, "Image"> implements SkImage {
     return toBase64String(bytes);
   }
 
+  encodeAsync(options: ImageEncodeOptions = {}) {
+    // Same validation as on native, zlibLevel and pngFilters are then ignored
+    const { pngFilters } = options;
+    if (
+      pngFilters !== undefined &&
+      (!Number.isInteger(pngFilters) ||
+        pngFilters < 0 ||
+        (pngFilters & ~PngFilter.All) !== 0)
+    ) {
+      throw new Error("pngFilters must be a combination of PngFilter values.");
+    }
+    const quality =
+      options.quality === undefined || Number.isNaN(options.quality)
+        ? 100
+        : Math.floor(Math.min(Math.max(options.quality, 0), 100));
+    let image: Image = this.ref;
+    const { width, height } = options;
+    if (width !== undefined || height !== undefined) {
+      const w =
+        width ?? Math.round((height! * image.width()) / image.height());
+      const h =
+        height ?? Math.round((width! * image.height()) / image.width());
+      const surface = this.CanvasKit.MakeSurface(w, h);
+      if (!surface) {
+        return Promise.resolve(null);
+      }
+      const canvas = surface.getCanvas();
+      canvas.drawImageRectCubic(
+        image,
+        this.CanvasKit.XYWHRect(0, 0, image.width(), image.height()),
+        this.CanvasKit.XYWHRect(0, 0, w, h),
+        1 / 3,
+        1 / 3
+      );
+      image = surface.makeImageSnapshot();
+      surface.delete();
+    }
+    const result = image.encodeToBytes(
+      ckEnum(options.format ?? ImageFormat.PNG),
+      quality
+    );
+    if (image !== this.ref) {
+      image.delete();
+    }
+    return Promise.resolve(result);
+  }
+
+  encodeToFileAsync(_path: string, _options?: ImageEncodeOptions): never {
+    throw new NotImplementedOnRNWeb();
+  }
+
   dispose = () => {
     this.ref.delete();
   };
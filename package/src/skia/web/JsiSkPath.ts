@@ -170,6 +170,10 @@ export class JsiSkPath extends HostObject<Path, "Path"> implements SkPath {
     return result === null ? result : this;
   }
 
+  strokeAsync(opts?: StrokeOpts) {
+    return Promise.resolve(this.copy().stroke(opts));
+  }
+
   close() {
     this.ref.close();
   }
@@ -256,6 +260,11 @@ export class JsiSkPath extends HostObject<Path, "Path"> implements SkPath {
     return this.ref.dash(on, off, phase);
   }
 
+  dashAsync(on: number, off: number, phase: number) {
+    const path = this.copy();
+    return Promise.resolve(path.dash(on, off, phase) ? path : null);
+  }
+
   equals(other: SkPath) {
     return this.ref.equals(JsiSkPath.fromValue(other));
   }
@@ -313,6 +322,16 @@ export class JsiSkPath extends HostObject<Path, "Path"> implements SkPath {
     return this.ref.simplify();
   }
 
+  opAsync(path: SkPath, op: PathOp) {
+    const result = this.copy();
+    return Promise.resolve(result.op(path, op) ? result : null);
+  }
+
+  simplifyAsync() {
+    const path = this.copy();
+    return Promise.resolve(path.simplify() ? path : null);
+  }
+
   toSVGString() {
     return this.ref.toSVGString();
   }
@@ -322,6 +341,10 @@ export class JsiSkPath extends HostObject<Path, "Path"> implements SkPath {
     return result === null ? result : this;
   }
 
+  trimAsync(startT: number, stopT: number, isComplement: boolean) {
+    return Promise.resolve(this.copy().trim(startT, stopT, isComplement));
+  }
+
   transform(m3: SkMatrix) {
     this.ref.transform(JsiSkMatrix.fromValue(m3));
   }
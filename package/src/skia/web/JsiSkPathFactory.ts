@@ -1,7 +1,10 @@
 import type { CanvasKit } from "canvaskit-wasm";
 
 import type { PathCommand, PathOp, SkFont, SkPath } from "../types";
-import type { PathFactory } from "../types/Path/PathFactory";
+import type {
+  PathCacheStats,
+  PathFactory,
+} from "../types/Path/PathFactory";
 
 import { Host, ckEnum, NotImplementedOnRNWeb } from "./Host";
 import { JsiSkPath } from "./JsiSkPath";
@@ -35,6 +38,23 @@ export class JsiSkPathFactory extends Host implements PathFactory {
     return new JsiSkPath(this.CanvasKit, path);
   }
 
+  MakeFromOpAsync(one: SkPath, two: SkPath, op: PathOp) {
+    return Promise.resolve(this.MakeFromOp(one, two, op));
+  }
+
+  MakeFromOpsAsync(paths: SkPath[], op: PathOp) {
+    if (paths.length === 0) {
+      return Promise.resolve(null);
+    }
+    const result = paths[0].copy();
+    for (let i = 1; i < paths.length; i++) {
+      if (!result.op(paths[i], op)) {
+        return Promise.resolve(null);
+      }
+    }
+    return Promise.resolve(result);
+  }
+
   MakeFromCmds(cmds: PathCommand[]) {
     const path = this.CanvasKit.Path.MakeFromCmds(cmds.flat());
     if (path === null) {
@@ -51,4 +71,8 @@ export class JsiSkPathFactory extends Host implements PathFactory {
   ): SkPath | null {
     throw new NotImplementedOnRNWeb();
   }
+
+  getCacheStats(): PathCacheStats {
+    return { hits: 0, misses: 0, entries: 0, bytes: 0 };
+  }
 }
@@ -17,4 +17,10 @@ export class JsiSkPictureFactory extends Host implements PictureFactory {
     }
     return new JsiSkPicture(this.CanvasKit, pic);
   }
+
+  MakePictureFromURI(uri: string) {
+    return fetch(uri)
+      .then((response) => response.arrayBuffer())
+      .then((data) => this.MakePicture(data));
+  }
 }
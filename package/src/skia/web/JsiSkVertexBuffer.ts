@@ -0,0 +1,72 @@
+import type { CanvasKit } from "canvaskit-wasm";
+
+import type {
+  SkVertexBuffer,
+  VertexBufferOptions,
+  VertexMode,
+} from "../types";
+
+import { ckEnum, Host } from "./Host";
+import { JsiSkRect } from "./JsiSkRect";
+
+export class JsiSkVertexBuffer extends Host implements SkVertexBuffer {
+  readonly __typename__ = "VertexBuffer" as const;
+
+  readonly positions: Float32Array;
+  readonly textures: Float32Array | null;
+  readonly colors: Uint32Array | null;
+  readonly indices: Uint16Array | null;
+
+  constructor(
+    CanvasKit: CanvasKit,
+    readonly mode: VertexMode,
+    vertexCount: number,
+    options: VertexBufferOptions = {}
+  ) {
+    super(CanvasKit);
+    this.positions = new Float32Array(vertexCount * 2);
+    this.textures = options.textures
+      ? new Float32Array(vertexCount * 2)
+      : null;
+    this.colors = options.colors ? new Uint32Array(vertexCount) : null;
+    this.indices = options.indexCount
+      ? new Uint16Array(options.indexCount)
+      : null;
+  }
+
+  dispose = () => {};
+
+  commit() {
+    // Vertices nodes draw on the JS thread on Web and read the arrays directly
+  }
+
+  bounds() {
+    let left = Infinity;
+    let top = Infinity;
+    let right = -Infinity;
+    let bottom = -Infinity;
+    for (let i = 0; i < this.positions.length; i += 2) {
+      left = Math.min(left, this.positions[i]);
+      right = Math.max(right, this.positions[i]);
+      top = Math.min(top, this.positions[i + 1]);
+      bottom = Math.max(bottom, this.positions[i + 1]);
+    }
+    if (this.positions.length === 0) {
+      left = top = right = bottom = 0;
+    }
+    return new JsiSkRect(
+      this.CanvasKit,
+      this.CanvasKit.LTRBRect(left, top, right, bottom)
+    );
+  }
+
+  makeVertices() {
+    return this.CanvasKit.MakeVertices(
+      ckEnum(this.mode),
+      this.positions,
+      this.textures,
+      this.colors,
+      this.indices ? Array.from(this.indices) : null
+    );
+  }
+}
@@ -8,6 +8,8 @@ import type {
   SkRuntimeEffect,
   SkRuntimeShaderBuilder,
   SkTypeface,
+  VertexBufferOptions,
+  VertexMode,
 } from "../types";
 
 import { JsiSkPoint } from "./JsiSkPoint";
@@ -35,6 +37,7 @@ import { JsiSkSVGFactory } from "./JsiSkSVGFactory";
 import { JsiSkTextBlobFactory } from "./JsiSkTextBlobFactory";
 import { JsiSkFont } from "./JsiSkFont";
 import { MakeVertices } from "./JsiSkVerticesFactory";
+import { JsiSkVertexBuffer } from "./JsiSkVertexBuffer";
 import { JsiSkPath } from "./JsiSkPath";
 import { JsiSkTypeface } from "./JsiSkTypeface";
 
@@ -94,6 +97,11 @@ export const JsiSkApi = (CanvasKit: CanvasKit): Skia => ({
   Shader: new JsiSkShaderFactory(CanvasKit),
   PathEffect: new JsiSkPathEffectFactory(CanvasKit),
   MakeVertices: MakeVertices.bind(null, CanvasKit),
+  MakeVertexBuffer: (
+    mode: VertexMode,
+    vertexCount: number,
+    options?: VertexBufferOptions
+  ) => new JsiSkVertexBuffer(CanvasKit, mode, vertexCount, options),
   Data: new JsiSkDataFactory(CanvasKit),
   Image: new JsiSkImageFactory(CanvasKit),
   SVG: new JsiSkSVGFactory(CanvasKit),
@@ -1,13 +1,17 @@
 import React from "react";
 import type { HostComponent } from "react-native";
 
-import type { SkRect } from "../skia/types";
+import type { SkPoint, SkRect } from "../skia/types";
 import type { SkiaValue } from "../values";
 import { Platform } from "../Platform";
 
 import { SkiaViewApi } from "./api";
 import { SkiaViewNativeId } from "./SkiaView";
-import type { NativeSkiaViewProps, SkiaDomViewProps } from "./types";
+import type {
+  DomCapture,
+  NativeSkiaViewProps,
+  SkiaDomViewProps,
+} from "./types";
 
 const NativeSkiaDomView: HostComponent<SkiaDomViewProps> =
   Platform.OS !== "web"
@@ -19,7 +23,7 @@ export class SkiaDomView extends React.Component<SkiaDomViewProps> {
   constructor(props: SkiaDomViewProps) {
     super(props);
     this._nativeId = SkiaViewNativeId.current++;
-    const { root, onTouch, onSize } = props;
+    const { root, onTouch, onTouchBuffer, onSize } = props;
     if (root) {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "root", root);
@@ -28,6 +32,14 @@ export class SkiaDomView extends React.Component<SkiaDomViewProps> {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "onTouch", onTouch);
     }
+    if (onTouchBuffer) {
+      assertSkiaViewApi();
+      SkiaViewApi.setJsiProperty(
+        this._nativeId,
+        "onTouchBuffer",
+        onTouchBuffer
+      );
+    }
     if (onSize) {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "onSize", onSize);
@@ -41,7 +53,7 @@ export class SkiaDomView extends React.Component<SkiaDomViewProps> {
   }
 
   componentDidUpdate(prevProps: SkiaDomViewProps) {
-    const { root, onTouch, onSize } = this.props;
+    const { root, onTouch, onTouchBuffer, onSize } = this.props;
     if (root !== prevProps.root) {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "root", root);
@@ -50,6 +62,14 @@ export class SkiaDomView extends React.Component<SkiaDomViewProps> {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "onTouch", onTouch);
     }
+    if (onTouchBuffer !== prevProps.onTouchBuffer) {
+      assertSkiaViewApi();
+      SkiaViewApi.setJsiProperty(
+        this._nativeId,
+        "onTouchBuffer",
+        onTouchBuffer
+      );
+    }
     if (onSize !== prevProps.onSize) {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "onSize", onSize);
@@ -66,6 +86,30 @@ export class SkiaDomView extends React.Component<SkiaDomViewProps> {
     return SkiaViewApi.makeImageSnapshot(this._nativeId, rect);
   }
 
+  /**
+   * Returns the ids of the nodes hit by a point or intersecting a rect,
+   * topmost node first. Nodes are tested against what was drawn in the
+   * last frame, ids are the `nodeId` of the nodes.
+   * @param query Point or rect in canvas coordinates.
+   */
+  public hitTest(query: SkPoint | SkRect): number[] {
+    assertSkiaViewApi();
+    return SkiaViewApi.callJsiMethod(
+      this._nativeId,
+      "hitTest",
+      query
+    ) as number[];
+  }
+
+  /**
+   * Renders the current frame while capturing the node tree and the drawing
+   * commands, for profiling offline with the dom-replay tool.
+   */
+  public capture(): DomCapture {
+    assertSkiaViewApi();
+    return SkiaViewApi.callJsiMethod(this._nativeId, "capture") as DomCapture;
+  }
+
   /**
    * Sends a redraw request to the native SkiaView.
    */
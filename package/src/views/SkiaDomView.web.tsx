@@ -15,6 +15,16 @@ export class SkiaDomView extends SkiaBaseWebView<SkiaDomViewProps> {
     if (this.props.onTouch) {
       this.props.onTouch([touches]);
     }
+    if (this.props.onTouchBuffer && touches.length > 0) {
+      const buffer = new Float64Array(touches.length * 6);
+      touches.forEach((touch, i) => {
+        buffer.set(
+          [touch.x, touch.y, touch.force, touch.type, touch.id, touch.timestamp],
+          i * 6
+        );
+      });
+      this.props.onTouchBuffer(buffer);
+    }
     if (this.props.onSize) {
       const { width, height } = this.getSize();
       if (isValue(this.props.onSize)) {
@@ -16,7 +16,7 @@ export class SkiaView extends React.Component<SkiaDrawViewProps> {
   constructor(props: SkiaDrawViewProps) {
     super(props);
     this._nativeId = SkiaViewNativeId.current++;
-    const { onDraw, onSize } = props;
+    const { onDraw, onSize, optimize } = props;
     if (onDraw) {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "drawCallback", onDraw);
@@ -25,6 +25,10 @@ export class SkiaView extends React.Component<SkiaDrawViewProps> {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "onSize", onSize);
     }
+    if (optimize) {
+      assertSkiaViewApi();
+      SkiaViewApi.setJsiProperty(this._nativeId, "optimize", optimize);
+    }
   }
 
   private _nativeId: number;
@@ -34,7 +38,7 @@ export class SkiaView extends React.Component<SkiaDrawViewProps> {
   }
 
   componentDidUpdate(prevProps: SkiaDrawViewProps) {
-    const { onDraw, onSize } = this.props;
+    const { onDraw, onSize, optimize } = this.props;
     if (onDraw !== prevProps.onDraw) {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "drawCallback", onDraw);
@@ -43,6 +47,10 @@ export class SkiaView extends React.Component<SkiaDrawViewProps> {
       assertSkiaViewApi();
       SkiaViewApi.setJsiProperty(this._nativeId, "onSize", onSize);
     }
+    if (optimize !== prevProps.optimize) {
+      assertSkiaViewApi();
+      SkiaViewApi.setJsiProperty(this._nativeId, "optimize", optimize);
+    }
   }
 
   /**
@@ -55,6 +55,24 @@ export type TouchHandlers = {
 
 export type TouchHandler = (touchInfo: Array<Array<TouchInfo>>) => void;
 
+/**
+ * Receives touches as rows of x, y, force, type, id and timestamp. Moves
+ * received between two frames are coalesced to the last position of each
+ * touch. The array is reused and is only valid during the call.
+ */
+export type TouchBufferHandler = (touches: Float64Array) => void;
+
+/**
+ * A captured frame of a SkiaDomView. `tree` is the JSON serialized node tree
+ * with the props, bounds and render times (in microseconds) of each node.
+ * `picture` is the recorded frame in the .skp format, where the drawing of each
+ * node is enclosed in annotations holding its node id.
+ */
+export interface DomCapture {
+  tree: string;
+  picture: Uint8Array | null;
+}
+
 export type RNSkiaDrawCallback = (canvas: SkCanvas, info: DrawingInfo) => void;
 
 /**
@@ -71,7 +89,7 @@ export interface ISkiaViewApi {
     nativeId: number,
     name: string,
     ...args: T
-  ) => void;
+  ) => unknown;
   registerValuesInView: (
     nativeId: number,
     values: SkiaValue<unknown>[]
@@ -110,6 +128,14 @@ export interface SkiaDrawViewProps extends SkiaBaseViewProps {
    * by the native view.
    */
   onDraw?: RNSkiaDrawCallback;
+  /**
+   * When set to true, runs of rects, rounded rects and ovals drawn with
+   * the same opaque paint are merged into single draws while recording.
+   * Antialiased shapes are only merged when they are at least a pixel
+   * apart, so the result looks the same. This makes drawings with many
+   * small shapes cheaper to render.
+   */
+  optimize?: boolean;
 }
 
 export interface SkiaPictureViewProps extends SkiaBaseViewProps {
@@ -119,4 +145,5 @@ export interface SkiaPictureViewProps extends SkiaBaseViewProps {
 export interface SkiaDomViewProps extends SkiaBaseViewProps {
   root?: RenderNode<GroupProps>;
   onTouch?: TouchHandler;
+  onTouchBuffer?: TouchBufferHandler;
 }
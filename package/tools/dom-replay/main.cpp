@@ -0,0 +1,196 @@
+// Replays a frame captured with SkiaDomView.capture() and reports how much
+// time each DOM node takes to rasterize.
+//
+// Usage: dom-replay <picture.skp> [tree.json] [iterations]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkData.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkStream.h"
+#include "include/core/SkSurface.h"
+#include "include/utils/SkNWayCanvas.h"
+
+namespace {
+
+// Must match the keys in JsiDomRenderNode
+constexpr const char *CaptureBeginKey = "RNSkia/DomNode/begin";
+constexpr const char *CaptureEndKey = "RNSkia/DomNode/end";
+
+using Clock = std::chrono::steady_clock;
+
+struct NodeCost {
+  double selfTime = 0;
+  double totalTime = 0;
+  size_t count = 0;
+};
+
+/**
+ Forwards all drawing to a raster canvas and attributes the time between two
+ node annotations to the node on top of the stack. Time spent outside of any
+ node is attributed to the id -1.
+ */
+class ProfilingCanvas : public SkNWayCanvas {
+public:
+  ProfilingCanvas(SkCanvas *target, int width, int height)
+      : SkNWayCanvas(width, height) {
+    addCanvas(target);
+    _last = Clock::now();
+  }
+
+  void finish() { attribute(); }
+
+  const std::map<long, NodeCost> &getCosts() const { return _costs; }
+
+protected:
+  void onDrawAnnotation(const SkRect &rect, const char key[],
+                        SkData *value) override {
+    auto isBegin = strcmp(key, CaptureBeginKey) == 0;
+    auto isEnd = strcmp(key, CaptureEndKey) == 0;
+    if ((!isBegin && !isEnd) || value == nullptr) {
+      SkNWayCanvas::onDrawAnnotation(rect, key, value);
+      return;
+    }
+
+    attribute();
+    auto id = strtol(static_cast<const char *>(value->data()), nullptr, 10);
+    if (isBegin) {
+      _stack.push_back({id, Clock::now()});
+    } else if (!_stack.empty() && _stack.back().id == id) {
+      auto &cost = _costs[id];
+      cost.totalTime += elapsed(_stack.back().start);
+      cost.count++;
+      _stack.pop_back();
+    }
+    _last = Clock::now();
+  }
+
+private:
+  struct Frame {
+    long id;
+    Clock::time_point start;
+  };
+
+  static double elapsed(Clock::time_point since) {
+    return std::chrono::duration<double, std::micro>(Clock::now() - since)
+        .count();
+  }
+
+  void attribute() {
+    auto id = _stack.empty() ? -1 : _stack.back().id;
+    _costs[id].selfTime += elapsed(_last);
+    _last = Clock::now();
+  }
+
+  std::vector<Frame> _stack;
+  std::map<long, NodeCost> _costs;
+  Clock::time_point _last;
+};
+
+/**
+ Reads the node types from the tree written by the capture. Nodes are written
+ as {"type":"...","nodeId":N,...} so a full JSON parser is not needed.
+ */
+std::map<long, std::string> readNodeTypes(const char *path) {
+  std::map<long, std::string> types;
+  std::ifstream file(path);
+  if (!file) {
+    fprintf(stderr, "Could not read %s\n", path);
+    return types;
+  }
+  std::stringstream buffer;
+  buffer << file.rdbuf();
+  auto json = buffer.str();
+
+  const std::string typeKey = "{\"type\":\"";
+  const std::string idKey = "\",\"nodeId\":";
+  size_t position = 0;
+  while ((position = json.find(typeKey, position)) != std::string::npos) {
+    auto typeStart = position + typeKey.size();
+    auto typeEnd = json.find(idKey, typeStart);
+    if (typeEnd == std::string::npos) {
+      break;
+    }
+    auto id = strtol(json.c_str() + typeEnd + idKey.size(), nullptr, 10);
+    types[id] = json.substr(typeStart, typeEnd - typeStart);
+    position = typeEnd;
+  }
+  return types;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "Usage: %s <picture.skp> [tree.json] [iterations]\n",
+            argv[0]);
+    return 1;
+  }
+
+  auto data = SkData::MakeFromFileName(argv[1]);
+  auto picture = data != nullptr ? SkPicture::MakeFromData(data.get())
+                                 : nullptr;
+  if (picture == nullptr) {
+    fprintf(stderr, "Could not read a picture from %s\n", argv[1]);
+    return 1;
+  }
+
+  std::map<long, std::string> types;
+  if (argc > 2) {
+    types = readNodeTypes(argv[2]);
+  }
+  auto iterations = argc > 3 ? std::max(1, atoi(argv[3])) : 10;
+
+  auto bounds = picture->cullRect().roundOut();
+  auto surface = SkSurface::MakeRasterN32Premul(bounds.width(),
+                                                bounds.height());
+  if (surface == nullptr) {
+    fprintf(stderr, "Could not create a %dx%d surface\n", bounds.width(),
+            bounds.height());
+    return 1;
+  }
+
+  std::map<long, NodeCost> costs;
+  for (auto i = 0; i < iterations; i++) {
+    surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+    ProfilingCanvas canvas(surface->getCanvas(), bounds.width(),
+                           bounds.height());
+    canvas.translate(-bounds.left(), -bounds.top());
+    picture->playback(&canvas);
+    canvas.finish();
+    for (auto &entry : canvas.getCosts()) {
+      auto &cost = costs[entry.first];
+      cost.selfTime += entry.second.selfTime;
+      cost.totalTime += entry.second.totalTime;
+      cost.count += entry.second.count;
+    }
+  }
+
+  std::vector<std::pair<long, NodeCost>> sorted(costs.begin(), costs.end());
+  std::sort(sorted.begin(), sorted.end(), [](auto &a, auto &b) {
+    return a.second.selfTime > b.second.selfTime;
+  });
+
+  printf("Average over %d iterations, times in microseconds\n", iterations);
+  printf("%8s  %-20s %12s %12s\n", "node", "type", "self", "total");
+  for (auto &entry : sorted) {
+    auto &cost = entry.second;
+    auto type = entry.first < 0 ? std::string("(outside nodes)")
+                                : types.count(entry.first) > 0
+                                      ? types[entry.first]
+                                      : std::string("?");
+    printf("%8ld  %-20s %12.2f %12.2f\n", entry.first, type.c_str(),
+           cost.selfTime / iterations, cost.totalTime / iterations);
+  }
+  return 0;
+}
@@ -0,0 +1,188 @@
+// Checks the hit test queries and grid of the DOM render nodes against a
+// desktop build of Skia.
+//
+// cmake -S . -B build -DSKIA_DIR=/path/to/skia
+// cmake --build build && ctest --test-dir build
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "dom/base/HitTest.h"
+
+#include "include/core/SkMatrix.h"
+#include "include/core/SkRect.h"
+
+namespace {
+
+using RNSkia::HitTestGrid;
+using RNSkia::HitTestQuery;
+
+int failures = 0;
+
+void check(bool condition, const char *message) {
+  if (!condition) {
+    fprintf(stderr, "FAILED: %s\n", message);
+    failures++;
+  }
+}
+
+std::vector<const SkRect *> pointers(const std::vector<SkRect> &rects) {
+  std::vector<const SkRect *> result;
+  for (auto &rect : rects) {
+    result.push_back(&rect);
+  }
+  return result;
+}
+
+void testPoints() {
+  auto rect = SkRect::MakeXYWH(10, 10, 20, 20);
+  check(HitTestQuery::MakePoint(15, 15).intersects(rect), "point inside");
+  check(HitTestQuery::MakePoint(10, 10).intersects(rect), "point on edge");
+  check(!HitTestQuery::MakePoint(5, 15).intersects(rect), "point outside");
+}
+
+void testRects() {
+  auto rect = SkRect::MakeXYWH(10, 10, 20, 20);
+  check(HitTestQuery::MakeRect(SkRect::MakeXYWH(0, 0, 15, 15))
+            .intersects(rect),
+        "overlapping rect");
+  check(HitTestQuery::MakeRect(SkRect::MakeXYWH(0, 0, 100, 100))
+            .intersects(rect),
+        "enclosing rect");
+  check(!HitTestQuery::MakeRect(SkRect::MakeXYWH(40, 0, 10, 10))
+             .intersects(rect),
+        "disjoint rect");
+}
+
+void testTransforms() {
+  auto query = HitTestQuery::MakePoint(110, 20);
+  HitTestQuery local = query;
+  check(query.mapToLocal(SkMatrix::Translate(100, 0), &local),
+        "translation is invertible");
+  check(local.isPoint() && local.getPoint() == SkPoint::Make(10, 20),
+        "point is mapped to the local space");
+
+  auto rectQuery = HitTestQuery::MakeRect(SkRect::MakeXYWH(0, 0, 20, 10));
+  check(rectQuery.mapToLocal(SkMatrix::Scale(2, 2), &local),
+        "scale is invertible");
+  check(!local.isPoint() && local.getRect() == SkRect::MakeWH(10, 5),
+        "rect is mapped to the local space");
+
+  // Rotated rects are mapped to their bounds
+  check(rectQuery.mapToLocal(SkMatrix::RotateDeg(45), &local),
+        "rotation is invertible");
+  check(local.getRect().contains(SkRect::MakeWH(1, 1)) &&
+            local.intersects(SkRect::MakeXYWH(9, -9, 1, 1)),
+        "rotated rect is conservative");
+
+  check(!query.mapToLocal(SkMatrix::Scale(0, 1), &local),
+        "singular matrix never hits");
+}
+
+void testGrid() {
+  std::vector<SkRect> rects;
+  for (int i = 0; i < 100; i++) {
+    rects.push_back(SkRect::MakeXYWH((i % 10) * 10, (i / 10) * 10, 10, 10));
+  }
+  // Drawn last, over the first cells
+  rects.push_back(SkRect::MakeXYWH(0, 0, 25, 25));
+  auto bounds = pointers(rects);
+  bounds.push_back(nullptr);
+
+  HitTestGrid grid;
+  check(!grid.isValid(), "grid is invalid until built");
+  grid.build(bounds);
+  check(grid.isValid(), "grid is valid once built");
+
+  auto hits = grid.query(HitTestQuery::MakePoint(5, 5));
+  check(!hits.empty() && hits[0] == 101, "unbounded child is always tested");
+  check(hits.size() >= 3 && hits[1] == 100 && hits.back() == 0,
+        "topmost child first");
+
+  hits = grid.query(HitTestQuery::MakePoint(95, 95));
+  check(std::find(hits.begin(), hits.end(), 99) != hits.end(),
+        "child in the last cell");
+  check(std::find(hits.begin(), hits.end(), 0) == hits.end(),
+        "far children are not returned");
+
+  hits = grid.query(HitTestQuery::MakePoint(500, 500));
+  check(hits.size() == 1 && hits[0] == 101,
+        "points outside of the grid only return unbounded children");
+
+  hits = grid.query(HitTestQuery::MakeRect(SkRect::MakeXYWH(45, 45, 10, 10)));
+  for (auto index : {44, 45, 54, 55}) {
+    check(std::find(hits.begin(), hits.end(), index) != hits.end(),
+          "rect returns all intersecting children");
+  }
+}
+
+void testUpdates() {
+  std::vector<SkRect> rects;
+  for (int i = 0; i < 64; i++) {
+    rects.push_back(SkRect::MakeXYWH((i % 8) * 10, (i / 8) * 10, 10, 10));
+  }
+  HitTestGrid grid;
+  check(!grid.update(0, &rects[0]), "invalid grid can't be updated");
+  grid.build(pointers(rects));
+
+  // Move the first child to the opposite corner
+  auto moved = SkRect::MakeXYWH(70, 70, 10, 10);
+  check(grid.update(0, &moved), "child is moved inside the grid");
+  auto hits = grid.query(HitTestQuery::MakePoint(75, 75));
+  check(std::find(hits.begin(), hits.end(), 0) != hits.end(),
+        "moved child is returned at its new position");
+  hits = grid.query(HitTestQuery::MakePoint(5, 5));
+  check(std::find(hits.begin(), hits.end(), 0) == hits.end(),
+        "moved child is not returned at its old position");
+
+  // Same result as building the grid with the new bounds
+  rects[0] = moved;
+  HitTestGrid rebuilt;
+  rebuilt.build(pointers(rects));
+  for (int y = 0; y < 80; y += 7) {
+    for (int x = 0; x < 80; x += 7) {
+      auto query = HitTestQuery::MakePoint(x, y);
+      std::vector<size_t> expected;
+      for (auto index : rebuilt.query(query)) {
+        if (query.intersects(rects[index])) {
+          expected.push_back(index);
+        }
+      }
+      std::vector<size_t> actual;
+      for (auto index : grid.query(query)) {
+        if (query.intersects(rects[index])) {
+          actual.push_back(index);
+        }
+      }
+      check(actual == expected, "updated grid matches the rebuilt grid");
+    }
+  }
+
+  // Children can lose and recover their bounds
+  check(grid.update(1, nullptr), "child loses its bounds");
+  hits = grid.query(HitTestQuery::MakePoint(500, 500));
+  check(hits.size() == 1 && hits[0] == 1, "child without bounds is returned");
+  check(grid.update(1, &rects[1]), "child recovers its bounds");
+  hits = grid.query(HitTestQuery::MakePoint(500, 500));
+  check(hits.empty(), "child with bounds is not returned outside");
+
+  auto outside = SkRect::MakeXYWH(100, 100, 10, 10);
+  check(!grid.update(2, &outside), "child outside of the grid is rejected");
+}
+
+} // namespace
+
+int main() {
+  testPoints();
+  testRects();
+  testTransforms();
+  testGrid();
+  testUpdates();
+  if (failures > 0) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
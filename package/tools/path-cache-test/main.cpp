@@ -0,0 +1,119 @@
+// Checks the hits, misses and eviction of RNSkPathCache against a desktop
+// build of Skia.
+//
+// cmake -S . -B build -DSKIA_DIR=/path/to/skia
+// cmake --build build && ctest --test-dir build
+
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "RNSkPathCache.h"
+
+namespace {
+
+using RNSkia::RNSkPathCache;
+
+int failures = 0;
+
+void check(bool condition, const char *message) {
+  if (!condition) {
+    fprintf(stderr, "FAILED: %s\n", message);
+    failures++;
+  }
+}
+
+std::string makeSvg(size_t index, size_t points = 1) {
+  std::string svg = "M 0 0";
+  for (size_t i = 0; i < points; i++) {
+    svg += " L " + std::to_string(index) + " " + std::to_string(i);
+  }
+  return svg;
+}
+
+void testHitsAndMisses() {
+  auto &cache = RNSkPathCache::getInstance();
+  auto before = cache.getStats();
+
+  auto first = cache.getPath("M 0 0 L 10 10 L 20 0 Z");
+  check(first != nullptr, "path is parsed");
+  check(first->countPoints() == 3, "parsed path has its points");
+  auto stats = cache.getStats();
+  check(stats.misses == before.misses + 1, "first lookup misses");
+  check(stats.entries == before.entries + 1, "parsed path is cached");
+  check(stats.bytes > before.bytes, "cached path is accounted for");
+
+  auto second = cache.getPath("M 0 0 L 10 10 L 20 0 Z");
+  check(second == first, "same string shares the path");
+  check(cache.getStats().hits == stats.hits + 1, "second lookup hits");
+
+  // Invalid strings are neither returned nor cached
+  auto entries = cache.getStats().entries;
+  check(cache.getPath("M 0 0 X") == nullptr, "invalid string has no path");
+  check(cache.getStats().entries == entries, "invalid string isn't cached");
+}
+
+void testEviction() {
+  auto &cache = RNSkPathCache::getInstance();
+  cache.getPath(makeSvg(0));
+
+  // More paths than the cache keeps, the least recently used ones go first
+  for (size_t i = 1; i < 5000; i++) {
+    cache.getPath(makeSvg(i));
+    if (i % 100 == 0) {
+      // Keeps the first path recently used
+      cache.getPath(makeSvg(0));
+    }
+  }
+  auto stats = cache.getStats();
+  check(stats.entries <= 4096, "number of entries is bounded");
+
+  auto misses = stats.misses;
+  cache.getPath(makeSvg(0));
+  check(cache.getStats().misses == misses, "recently used path is kept");
+  cache.getPath(makeSvg(1));
+  check(cache.getStats().misses == misses + 1, "oldest path is evicted");
+
+  // Large paths are returned without being cached
+  auto entries = cache.getStats().entries;
+  auto large = cache.getPath(makeSvg(0, 100000));
+  check(large != nullptr, "large path is parsed");
+  check(cache.getStats().entries <= entries, "large path isn't cached");
+}
+
+void testConcurrentLookups() {
+  auto &cache = RNSkPathCache::getInstance();
+  std::atomic<size_t> errors = {0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++) {
+    threads.emplace_back([&cache, &errors] {
+      for (size_t i = 0; i < 2000; i++) {
+        auto path = cache.getPath(makeSvg(10000 + i % 50));
+        if (path == nullptr || path->countPoints() != 2) {
+          errors++;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  check(errors == 0, "concurrent lookups return the right paths");
+  check(cache.getStats().entries <= 4096, "cache is consistent");
+}
+
+} // namespace
+
+int main() {
+  testHitsAndMisses();
+  testEviction();
+  testConcurrentLookups();
+  if (failures > 0) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
@@ -0,0 +1,145 @@
+// Checks the raster path of RNSkSurfacePool against a desktop build of Skia.
+//
+// cmake -S . -B build -DSKIA_DIR=/path/to/skia
+// cmake --build build && ctest --test-dir build
+
+#include <climits>
+#include <cstdio>
+
+#include "RNSkSurfacePool.h"
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkSurface.h"
+
+namespace {
+
+int failures = 0;
+
+void check(bool condition, const char *message) {
+  if (!condition) {
+    fprintf(stderr, "FAILED: %s\n", message);
+    failures++;
+  }
+}
+
+SkColor pixelAt(SkSurface *surface, int x, int y) {
+  SkPixmap pixmap;
+  if (!surface->peekPixels(&pixmap)) {
+    return SK_ColorTRANSPARENT;
+  }
+  return pixmap.getColor(x, y);
+}
+
+SkColor pixelAt(SkImage *image, int x, int y) {
+  SkPixmap pixmap;
+  if (!image->peekPixels(&pixmap)) {
+    return SK_ColorTRANSPARENT;
+  }
+  return pixmap.getColor(x, y);
+}
+
+void testInvalidSizes() {
+  auto &pool = RNSkia::RNSkSurfacePool::getInstance();
+  check(pool.makeRasterSurface(0, 10) == nullptr, "empty width");
+  check(pool.makeRasterSurface(10, -1) == nullptr, "negative height");
+  check(pool.makeRasterSurface(10, 10, kUnknown_SkColorType) == nullptr,
+        "unknown color type");
+  // The byte size overflows, it must not be pooled nor allocated
+  check(pool.makeRasterSurface(INT_MAX, INT_MAX) == nullptr,
+        "overflowing size");
+}
+
+void testReuse() {
+  auto &pool = RNSkia::RNSkSurfacePool::getInstance();
+  auto surface = pool.makeRasterSurface(100, 50);
+  check(surface != nullptr, "surface is created");
+  auto first = surface.get();
+  surface->getCanvas()->save();
+  surface->getCanvas()->translate(10, 10);
+  surface->getCanvas()->clear(SK_ColorRED);
+
+  surface = nullptr;
+  auto other = pool.makeRasterSurface(50, 100);
+  check(other.get() != first, "surface of another size is not reused");
+
+  surface = pool.makeRasterSurface(100, 50);
+  check(surface.get() == first, "released surface is reused");
+  check(surface->width() == 100 && surface->height() == 50, "exact size");
+  check(pixelAt(surface.get(), 0, 0) == SK_ColorTRANSPARENT,
+        "reused surface is cleared");
+  check(surface->getCanvas()->getSaveCount() == 1, "save count is reset");
+  check(surface->getCanvas()->getTotalMatrix().isIdentity(),
+        "matrix is reset");
+
+  auto inUse = pool.makeRasterSurface(100, 50);
+  check(inUse.get() != first, "surface in use is not handed out");
+}
+
+void testSnapshots() {
+  auto &pool = RNSkia::RNSkSurfacePool::getInstance();
+  auto surface = pool.makeRasterSurface(64, 64);
+  surface->getCanvas()->clear(SK_ColorBLUE);
+  auto image = surface->makeImageSnapshot();
+
+  SkPixmap surfacePixels;
+  SkPixmap imagePixels;
+  surface->peekPixels(&surfacePixels);
+  image->peekPixels(&imagePixels);
+  check(surfacePixels.addr() == imagePixels.addr(),
+        "snapshot shares the pixels of the surface");
+
+  auto first = surface.get();
+  surface = nullptr;
+  surface = pool.makeRasterSurface(64, 64);
+  check(surface.get() == first, "surface with a live snapshot is reused");
+  check(pixelAt(surface.get(), 0, 0) == SK_ColorTRANSPARENT,
+        "reused surface is cleared");
+  check(pixelAt(image.get(), 0, 0) == SK_ColorBLUE,
+        "snapshot keeps its pixels when the surface is reused");
+}
+
+void testClip() {
+  auto &pool = RNSkia::RNSkSurfacePool::getInstance();
+  auto surface = pool.makeRasterSurface(32, 32);
+  auto first = surface.get();
+  // Without save(), the clip outlives the user of the surface
+  surface->getCanvas()->clipRect(SkRect::MakeWH(8, 8));
+  surface = nullptr;
+  surface = pool.makeRasterSurface(32, 32);
+  check(surface.get() != first, "clipped surface is not reused");
+  check(surface->getCanvas()->getDeviceClipBounds() == SkIRect::MakeWH(32, 32),
+        "new surface is not clipped");
+}
+
+void testPurge() {
+  auto &pool = RNSkia::RNSkSurfacePool::getInstance();
+  auto surface = pool.makeRasterSurface(48, 48);
+  auto inUse = pool.makeRasterSurface(48, 48);
+  // The surfaces keep their last snapshot until they are drawn to again, so
+  // the snapshots tell if the surfaces are still alive
+  auto image = surface->makeImageSnapshot();
+  auto inUseImage = inUse->makeImageSnapshot();
+  surface = nullptr;
+  check(!image->unique(), "released surface is pooled");
+  pool.purgeUnused();
+  check(image->unique(), "released surface is purged");
+  check(!inUseImage->unique(), "surface in use is not purged");
+}
+
+} // namespace
+
+int main() {
+  testInvalidSizes();
+  testReuse();
+  testSnapshots();
+  testClip();
+  testPurge();
+  if (failures > 0) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}
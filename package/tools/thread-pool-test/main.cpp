@@ -0,0 +1,255 @@
+// Stress tests RNSkWorkDeque and RNSkThreadPool: steals racing with pops,
+// nested dispatches, render thread ordering and shutting down with work in
+// flight.
+//
+// cmake -S . -B build -DSANITIZE=ON
+// cmake --build build && ctest --test-dir build
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "RNSkThreadPool.h"
+
+namespace {
+
+using RNSkia::RNSkTask;
+using RNSkia::RNSkThreadPool;
+using RNSkia::RNSkWorkDeque;
+
+int failures = 0;
+
+void check(bool condition, const char *message) {
+  if (!condition) {
+    fprintf(stderr, "FAILED: %s\n", message);
+    failures++;
+  }
+}
+
+/**
+ Waits until a number of tasks have run.
+ */
+class Latch {
+public:
+  explicit Latch(size_t count) : _count(count) {}
+
+  void countDown() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (--_count == 0) {
+      _done.notify_all();
+    }
+  }
+
+  bool wait() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    return _done.wait_for(lock, std::chrono::seconds(30),
+                          [this] { return _count == 0; });
+  }
+
+private:
+  std::mutex _mutex;
+  std::condition_variable _done;
+  size_t _count;
+};
+
+void testTask() {
+  auto counter = std::make_shared<int>(0);
+  RNSkTask task([counter] { (*counter)++; });
+  RNSkTask moved(std::move(task));
+  check(!task && moved, "task is moved");
+  moved();
+  check(*counter == 1, "moved task runs");
+  moved.reset();
+  check(counter.use_count() == 1, "reset destroys the callable");
+
+  // Too large to be stored inline
+  std::array<char, RNSkTask::InlineSize * 2> large = {};
+  RNSkTask heap([large, counter] { (*counter) += large.size() > 0; });
+  RNSkTask other;
+  other = std::move(heap);
+  other();
+  check(*counter == 2, "heap task runs after a move");
+}
+
+// The owner pushes and pops while thieves steal, every task must run once
+void testDequeSteals() {
+  constexpr size_t TaskCount = 200000;
+  constexpr size_t ThiefCount = 4;
+  RNSkWorkDeque deque;
+  std::vector<std::atomic<int>> runs(TaskCount);
+  std::atomic<bool> done = {false};
+  std::atomic<size_t> stolen = {0};
+
+  std::vector<std::thread> thieves;
+  for (size_t i = 0; i < ThiefCount; i++) {
+    thieves.emplace_back([&] {
+      RNSkTask task;
+      while (!done) {
+        if (deque.steal(&task)) {
+          task();
+          task.reset();
+          stolen++;
+        }
+      }
+    });
+  }
+
+  size_t next = 0;
+  RNSkTask task;
+  while (next < TaskCount) {
+    // Push a small batch, then pop some of it back
+    auto batch = 1 + next % 7;
+    for (size_t i = 0; i < batch && next < TaskCount; i++) {
+      RNSkTask pushed([&runs, index = next] { runs[index]++; });
+      if (!deque.push(&pushed)) {
+        // Full, run it ourselves
+        pushed();
+      }
+      next++;
+    }
+    for (size_t i = 0; i < batch / 2; i++) {
+      if (deque.pop(&task)) {
+        task();
+        task.reset();
+      }
+    }
+  }
+  while (deque.pop(&task)) {
+    task();
+    task.reset();
+  }
+  done = true;
+  for (auto &thief : thieves) {
+    thief.join();
+  }
+
+  size_t missing = 0;
+  size_t duplicates = 0;
+  for (auto &count : runs) {
+    missing += count == 0;
+    duplicates += count > 1;
+  }
+  check(missing == 0, "every pushed task runs");
+  check(duplicates == 0, "no task runs twice");
+  printf("deque: %zu of %zu tasks stolen\n", stolen.load(), TaskCount);
+}
+
+// Tasks that dispatch more tasks from the pool threads, which go to the
+// deques of these threads and get stolen by the others
+void testNestedDispatch() {
+  constexpr size_t Depth = 12;
+  RNSkThreadPool pool("test", 4);
+  Latch latch((1 << Depth) - 1);
+  std::atomic<size_t> runs = {0};
+
+  std::function<void(size_t)> spawn = [&](size_t depth) {
+    runs++;
+    if (depth + 1 < Depth) {
+      for (int i = 0; i < 2; i++) {
+        pool.dispatch([&spawn, depth] { spawn(depth + 1); },
+                      depth % 2 == 0 ? RNSkThreadPool::Priority::Present
+                                     : RNSkThreadPool::Priority::Background);
+      }
+    }
+    latch.countDown();
+  };
+  pool.dispatch([&spawn] { spawn(0); });
+  check(latch.wait(), "nested tasks complete");
+  check(runs == (1 << Depth) - 1, "every nested task runs once");
+}
+
+// Render thread tasks run in order, and the render thread never runs
+// background tasks
+void testRenderThread() {
+  constexpr size_t TaskCount = 10000;
+  RNSkThreadPool pool("test", 3);
+  std::thread::id renderThread;
+  Latch started(1);
+  pool.dispatchToRenderThread([&] {
+    renderThread = std::this_thread::get_id();
+    started.countDown();
+  });
+  check(started.wait(), "render thread runs");
+
+  Latch latch(TaskCount * 2);
+  std::mutex mutex;
+  std::vector<size_t> order;
+  std::atomic<size_t> backgroundOnRenderThread = {0};
+  for (size_t i = 0; i < TaskCount; i++) {
+    pool.dispatchToRenderThread([&, i] {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        order.push_back(i);
+      }
+      latch.countDown();
+    });
+    pool.dispatch(
+        [&] {
+          if (std::this_thread::get_id() == renderThread) {
+            backgroundOnRenderThread++;
+          }
+          latch.countDown();
+        },
+        RNSkThreadPool::Priority::Background);
+  }
+  check(latch.wait(), "render and background tasks complete");
+
+  auto isOrdered = order.size() == TaskCount;
+  for (size_t i = 0; isOrdered && i < order.size(); i++) {
+    isOrdered = order[i] == i;
+  }
+  check(isOrdered, "render thread tasks run in dispatch order");
+  check(backgroundOnRenderThread == 0,
+        "background tasks don't run on the render thread");
+}
+
+// Destroys pools while their threads are busy pushing, popping and stealing.
+// Tasks that didn't run are dropped, the pool must neither hang nor crash.
+void testShutdown() {
+  constexpr size_t Iterations = 200;
+  std::atomic<size_t> runs = {0};
+  for (size_t i = 0; i < Iterations; i++) {
+    auto pool = std::make_unique<RNSkThreadPool>("test", 1 + i % 4);
+    auto raw = pool.get();
+    for (size_t j = 0; j < 64; j++) {
+      raw->dispatch([raw, &runs] {
+        runs++;
+        // Lands in the deque of the pool thread while it shuts down
+        for (int k = 0; k < 8; k++) {
+          raw->dispatch([&runs] { runs++; },
+                        RNSkThreadPool::Priority::Background);
+        }
+      });
+      raw->dispatchToRenderThread([&runs] { runs++; });
+    }
+    if (i % 2 == 0) {
+      std::this_thread::yield();
+    }
+    pool = nullptr;
+  }
+  printf("shutdown: %zu tasks ran before the pools were destroyed\n",
+         runs.load());
+}
+
+} // namespace
+
+int main() {
+  testTask();
+  testDequeSteals();
+  testNestedDispatch();
+  testRenderThread();
+  testShutdown();
+  if (failures > 0) {
+    fprintf(stderr, "%d check(s) failed\n", failures);
+    return 1;
+  }
+  printf("All checks passed\n");
+  return 0;
+}